@@ -1867,16 +1867,18 @@ void parallelDual5(AbcSimplexFactorization *factorization,
    2 Left Lower Transpose Unit
    3 Left Upper Transpose NonUnit
 */
-static void CoinAbcDtrsmFactor(int m, int n, double *COIN_RESTRICT a, int lda)
+static void CoinAbcDtrsmFactor(int m, int n, double *COIN_RESTRICT a,
+  double *COIN_RESTRICT b, int lda)
 {
   assert((m & (BLOCKING8 - 1)) == 0 && (n & (BLOCKING8 - 1)) == 0);
   assert(m == BLOCKING8);
   // 0 Left Lower NoTranspose Unit
   /* entry for column j and row i (when multiple of BLOCKING8)
      is at aBlocked+j*m+i*BLOCKING8
+     b need not be next to a
   */
   double *COIN_RESTRICT aBase2 = a;
-  double *COIN_RESTRICT bBase2 = aBase2 + lda * BLOCKING8;
+  double *COIN_RESTRICT bBase2 = b;
   for (int jj = 0; jj < n; jj += BLOCKING8) {
     double *COIN_RESTRICT bBase = bBase2;
     for (int j = jj; j < jj + BLOCKING8; j++) {
@@ -2385,6 +2387,31 @@ CoinAbcDlaswp(int n, double *COIN_RESTRICT a, int lda, int start, int end, int *
     }
   }
 }
+/* Row swaps and unit lower triangular solve on n columns starting
+   at column c - a is diagonal block.  Column blocks are independent
+   so split them over threads */
+static void CoinAbcDlaswpTrsm(int n, double *COIN_RESTRICT a, double *COIN_RESTRICT c,
+  int lda, int start, int end, int *ipiv
+#if ABC_PARALLEL == 2
+  ,
+  int parallelMode
+#endif
+)
+{
+  assert((n & (BLOCKING8 - 1)) == 0);
+#if ABC_PARALLEL == 2
+  if (parallelMode && n > CILK_DTRSM * BLOCKING8) {
+    // make sure nNew1 multiple of BLOCKING8
+    int nNew1 = ((n + 15) >> 4) << 3;
+    cilk_spawn CoinAbcDlaswpTrsm(nNew1, a, c, lda, start, end, ipiv, parallelMode);
+    CoinAbcDlaswpTrsm(n - nNew1, a, c + nNew1 * lda, lda, start, end, ipiv, parallelMode);
+    cilk_sync;
+    return;
+  }
+#endif
+  CoinAbcDlaswp(n, c, lda, start, end, ipiv);
+  CoinAbcDtrsmFactor(end - start, n, a, c + start * BLOCKING8, lda);
+}
 extern void CoinAbcDgemm(int m, int n, int k, double *COIN_RESTRICT a, int lda,
   double *COIN_RESTRICT b, double *COIN_RESTRICT c
 #if ABC_PARALLEL == 2
@@ -2513,9 +2540,14 @@ int CoinAbcDgetrf(int m, int n, double *COIN_RESTRICT a, int lda, int *ipiv
         // swap 0<start
         CoinAbcDlaswp(start, a, lda, start, end, ipiv);
         if (end < n) {
-          // swap >=end
-          CoinAbcDlaswp(n - end, a + end * lda, lda, start, end, ipiv);
-          CoinAbcDtrsmFactor(newSize, n - end, a + (start * lda + start * BLOCKING8), lda);
+          // swap >=end and get U part (in parallel by column blocks)
+          CoinAbcDlaswpTrsm(n - end, a + (start * lda + start * BLOCKING8),
+            a + end * lda, lda, start, end, ipiv
+#if ABC_PARALLEL == 2
+            ,
+            parallelMode
+#endif
+          );
           CoinAbcDgemm(n - end, n - end, newSize,
             a + start * lda + end * BLOCKING8, lda,
             a + end * lda + start * BLOCKING8, a + end * lda + end * BLOCKING8
@@ -2554,16 +2586,18 @@ void CoinAbcDgetrs(char trans, int m, double *COIN_RESTRICT a, double *COIN_REST
    2 Left Lower Transpose Unit
    3 Left Upper Transpose NonUnit
 */
-static void CoinAbcDtrsmFactor(int m, int n, long double *COIN_RESTRICT a, int lda)
+static void CoinAbcDtrsmFactor(int m, int n, long double *COIN_RESTRICT a,
+  long double *COIN_RESTRICT b, int lda)
 {
   assert((m & (BLOCKING8 - 1)) == 0 && (n & (BLOCKING8 - 1)) == 0);
   assert(m == BLOCKING8);
   // 0 Left Lower NoTranspose Unit
   /* entry for column j and row i (when multiple of BLOCKING8)
      is at aBlocked+j*m+i*BLOCKING8
+     b need not be next to a
   */
   long double *COIN_RESTRICT aBase2 = a;
-  long double *COIN_RESTRICT bBase2 = aBase2 + lda * BLOCKING8;
+  long double *COIN_RESTRICT bBase2 = b;
   for (int jj = 0; jj < n; jj += BLOCKING8) {
     long double *COIN_RESTRICT bBase = bBase2;
     for (int j = jj; j < jj + BLOCKING8; j++) {
@@ -3072,6 +3106,31 @@ CoinAbcDlaswp(int n, long double *COIN_RESTRICT a, int lda, int start, int end,
     }
   }
 }
+/* Row swaps and unit lower triangular solve on n columns starting
+   at column c - a is diagonal block.  Column blocks are independent
+   so split them over threads */
+static void CoinAbcDlaswpTrsm(int n, long double *COIN_RESTRICT a, long double *COIN_RESTRICT c,
+  int lda, int start, int end, int *ipiv
+#if ABC_PARALLEL == 2
+  ,
+  int parallelMode
+#endif
+)
+{
+  assert((n & (BLOCKING8 - 1)) == 0);
+#if ABC_PARALLEL == 2
+  if (parallelMode && n > CILK_DTRSM * BLOCKING8) {
+    // make sure nNew1 multiple of BLOCKING8
+    int nNew1 = ((n + 15) >> 4) << 3;
+    cilk_spawn CoinAbcDlaswpTrsm(nNew1, a, c, lda, start, end, ipiv, parallelMode);
+    CoinAbcDlaswpTrsm(n - nNew1, a, c + nNew1 * lda, lda, start, end, ipiv, parallelMode);
+    cilk_sync;
+    return;
+  }
+#endif
+  CoinAbcDlaswp(n, c, lda, start, end, ipiv);
+  CoinAbcDtrsmFactor(end - start, n, a, c + start * BLOCKING8, lda);
+}
 extern void CoinAbcDgemm(int m, int n, int k, long double *COIN_RESTRICT a, int lda,
   long double *COIN_RESTRICT b, long double *COIN_RESTRICT c
 #if ABC_PARALLEL == 2
@@ -3200,9 +3259,14 @@ int CoinAbcDgetrf(int m, int n, long double *COIN_RESTRICT a, int lda, int *ipiv
         // swap 0<start
         CoinAbcDlaswp(start, a, lda, start, end, ipiv);
         if (end < n) {
-          // swap >=end
-          CoinAbcDlaswp(n - end, a + end * lda, lda, start, end, ipiv);
-          CoinAbcDtrsmFactor(newSize, n - end, a + (start * lda + start * BLOCKING8), lda);
+          // swap >=end and get U part (in parallel by column blocks)
+          CoinAbcDlaswpTrsm(n - end, a + (start * lda + start * BLOCKING8),
+            a + end * lda, lda, start, end, ipiv
+#if ABC_PARALLEL == 2
+            ,
+            parallelMode
+#endif
+          );
           CoinAbcDgemm(n - end, n - end, newSize,
             a + start * lda + end * BLOCKING8, lda,
             a + end * lda + start * BLOCKING8, a + end * lda + end * BLOCKING8
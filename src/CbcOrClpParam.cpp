@@ -1558,6 +1558,16 @@ void establishParams(std::vector< CbcOrClpParam > &parameters)
     "Decide whether to use A Basic Optimization Code (Accelerated?) \
 and whether to try going parallel!");
   parameters.push_back(paramAboca);
+  {
+    CbcOrClpParam p("determ!inistic", "Whether parallel results must not depend on number of threads",
+      "off", CLP_PARAM_STR_DETERMINISTIC);
+    p.append("on");
+    p.setLonghelp(
+      "If on, parallel sections always split work into the same number of blocks and combine them \
+in the same order, so iterations and solution are the same whatever number of threads is used. \
+This may be slightly slower.");
+    parameters.push_back(p);
+  }
 #endif
   {
     CbcOrClpParam p("allC!ommands", "Whether to print less used commands",
@@ -1643,6 +1653,18 @@ with quadratic objectives.");
  is initialized to 'default.bas'.");
     parameters.push_back(p);
   }
+  {
+    CbcOrClpParam p("bench!mark", "Do benchmark of solver kernels",
+      CLP_PARAM_ACTION_BENCHMARK, 3, 1);
+    p.setLonghelp(
+      "This times matrix products, ftran and btran and dual, primal and barrier \
+solves on generated, sample and netlib problems.  Times are written to clpBench.json \
+and compared with clpBenchBaseline.json if that exists.  The return code is nonzero \
+if any kernel is more than 25% slower than the baseline.  A baseline is made by \
+copying clpBench.json from a good build to clpBenchBaseline.json (make bench-baseline \
+in the test directory does this).");
+    parameters.push_back(p);
+  }
   {
     CbcOrClpParam p("biasLU", "Whether factorization biased towards U",
       "UU", CLP_PARAM_STR_BIASLU, 2, 0);
@@ -1854,11 +1876,14 @@ Cbc/examples/driver4.cpp.");
     p.append("idiot6");
     p.append("idiot7");
 #endif
+    p.append("tri!angular");
     p.setLonghelp(
       "If crash is set to 'on' and there is an all slack basis then Clp will flip or put structural\
      variables into the basis with the aim of getting dual feasible.  On average, dual simplex seems to perform\
      better without it and there are alternative types of 'crash' for primal simplex, e.g. 'idiot' or 'sprint'. \
-    A variant due to Solow and Halim which is as 'on' but just flips is also available.");
+    A variant due to Solow and Halim which is as 'on' but just flips is also available.  \
+'triangular' puts structural variables into the basis while keeping it triangular, preferring \
+free and cheap variables.");
 
     parameters.push_back(p);
   }
@@ -185,6 +185,7 @@ enum CbcOrClpParameterType
   CLP_PARAM_STR_TIME_MODE,
   CLP_PARAM_STR_ABCWANTED,
   CLP_PARAM_STR_BUFFER_MODE,
+  CLP_PARAM_STR_DETERMINISTIC,
 
   CBC_PARAM_STR_NODESTRATEGY = 301,
   CBC_PARAM_STR_BRANCHSTRATEGY,
@@ -292,6 +293,7 @@ enum CbcOrClpParameterType
   CLP_PARAM_ACTION_GMPL_SOLUTION,
   CLP_PARAM_ACTION_RESTORESOL,
   CLP_PARAM_ACTION_GUESS,
+  CLP_PARAM_ACTION_BENCHMARK,
 
   CBC_PARAM_ACTION_BAB = 501,
   CBC_PARAM_ACTION_MIPLIB,
@@ -21,6 +21,7 @@
 
 #include "CoinPragma.hpp"
 
+#include <cstdio>
 #include <iostream>
 
 #include "ClpCholeskyBase.hpp"
@@ -69,6 +70,11 @@ ClpCholeskyBase::ClpCholeskyBase(int denseThreshold)
   , denseColumn_(NULL)
   , dense_(NULL)
   , denseThreshold_(denseThreshold)
+  , structureHash_(0)
+  , numberColumns_(0)
+  , structureStart_(NULL)
+  , structureRow_(NULL)
+  , numberReuses_(0)
 {
   memset(integerParameters_, 0, 64 * sizeof(int));
   memset(doubleParameters_, 0, 64 * sizeof(double));
@@ -110,11 +116,22 @@ ClpCholeskyBase::ClpCholeskyBase(const ClpCholeskyBase &rhs)
   clique_ = ClpCopyOfArray(rhs.clique_, numberRows_);
   CoinMemcpyN(rhs.integerParameters_, 64, integerParameters_);
   CoinMemcpyN(rhs.doubleParameters_, 64, doubleParameters_);
-  rowCopy_ = rhs.rowCopy_->clone();
+  rowCopy_ = rhs.rowCopy_ ? rhs.rowCopy_->clone() : NULL;
   whichDense_ = NULL;
   denseColumn_ = NULL;
   dense_ = NULL;
   denseThreshold_ = rhs.denseThreshold_;
+  // dense information not copied so only reuse structure if none
+  structureHash_ = rhs.whichDense_ ? 0 : rhs.structureHash_;
+  numberColumns_ = rhs.numberColumns_;
+  if (rhs.structureStart_) {
+    structureStart_ = ClpCopyOfArray(rhs.structureStart_, numberColumns_ + 1);
+    structureRow_ = ClpCopyOfArray(rhs.structureRow_, structureStart_[numberColumns_]);
+  } else {
+    structureStart_ = NULL;
+    structureRow_ = NULL;
+  }
+  numberReuses_ = rhs.numberReuses_;
 }
 
 //-------------------------------------------------------------------
@@ -134,6 +151,8 @@ ClpCholeskyBase::~ClpCholeskyBase()
   delete[] link_;
   delete[] workInteger_;
   delete[] clique_;
+  delete[] structureStart_;
+  delete[] structureRow_;
   delete rowCopy_;
   delete[] whichDense_;
   delete[] denseColumn_;
@@ -193,14 +212,352 @@ ClpCholeskyBase::operator=(const ClpCholeskyBase &rhs)
     link_ = ClpCopyOfArray(rhs.link_, numberRows_);
     workInteger_ = ClpCopyOfArray(rhs.workInteger_, numberRows_);
     clique_ = ClpCopyOfArray(rhs.clique_, numberRows_);
-    rowCopy_ = rhs.rowCopy_->clone();
+    rowCopy_ = rhs.rowCopy_ ? rhs.rowCopy_->clone() : NULL;
     whichDense_ = NULL;
     denseColumn_ = NULL;
     dense_ = NULL;
     denseThreshold_ = rhs.denseThreshold_;
+    structureHash_ = rhs.whichDense_ ? 0 : rhs.structureHash_;
+    numberColumns_ = rhs.numberColumns_;
+    delete[] structureStart_;
+    delete[] structureRow_;
+    if (rhs.structureStart_) {
+      structureStart_ = ClpCopyOfArray(rhs.structureStart_, numberColumns_ + 1);
+      structureRow_ = ClpCopyOfArray(rhs.structureRow_, structureStart_[numberColumns_]);
+    } else {
+      structureStart_ = NULL;
+      structureRow_ = NULL;
+    }
+    numberReuses_ = rhs.numberReuses_;
   }
   return *this;
 }
+/* Records structure of model ordering and symbolic were done for
+   (hash 0 means none) */
+void ClpCholeskyBase::setStructure(const ClpInterior *model, unsigned int hash)
+{
+  structureHash_ = hash;
+  delete[] structureStart_;
+  structureStart_ = NULL;
+  delete[] structureRow_;
+  structureRow_ = NULL;
+  numberColumns_ = 0;
+  if (hash) {
+    // keep pattern packed so can be compared exactly
+    numberColumns_ = model->numberColumns();
+    const CoinBigIndex *columnStart = model->clpMatrix()->getVectorStarts();
+    const int *columnLength = model->clpMatrix()->getVectorLengths();
+    const int *row = model->clpMatrix()->getIndices();
+    structureStart_ = new CoinBigIndex[numberColumns_ + 1];
+    CoinBigIndex numberElements = 0;
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++)
+      numberElements += columnLength[iColumn];
+    structureRow_ = new int[CoinMax(numberElements, static_cast< CoinBigIndex >(1))];
+    numberElements = 0;
+    structureStart_[0] = 0;
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      CoinMemcpyN(row + columnStart[iColumn], columnLength[iColumn],
+        structureRow_ + numberElements);
+      numberElements += columnLength[iColumn];
+      structureStart_[iColumn + 1] = numberElements;
+    }
+  }
+}
+/* If ordering and symbolic factorization were done (or restored) by this
+   class for a matrix with same structure then refreshes row copy (values
+   may have changed) and returns true.  Hash, sizes and every row index
+   must match */
+bool ClpCholeskyBase::reuseStructure(ClpInterior *model, unsigned int hash)
+{
+  if (type_ || doKKT_)
+    return false;
+  bool same = hash && hash == structureHash_ && permute_ && choleskyStart_
+    && model->numberRows() == numberRows_
+    && model->numberColumns() == numberColumns_ && structureStart_;
+  if (same) {
+    const CoinBigIndex *columnStart = model->clpMatrix()->getVectorStarts();
+    const int *columnLength = model->clpMatrix()->getVectorLengths();
+    const int *row = model->clpMatrix()->getIndices();
+    for (int iColumn = 0; iColumn < numberColumns_ && same; iColumn++) {
+      CoinBigIndex start = structureStart_[iColumn];
+      if (columnLength[iColumn] != structureStart_[iColumn + 1] - start) {
+        same = false;
+        break;
+      }
+      const int *rowThis = row + columnStart[iColumn];
+      for (int j = 0; j < columnLength[iColumn]; j++) {
+        if (rowThis[j] != structureRow_[start + j]) {
+          same = false;
+          break;
+        }
+      }
+    }
+  }
+  if (!same) {
+    // order and symbolic will be redone
+    if (permute_)
+      freeStructure();
+    return false;
+  }
+  model_ = model;
+  delete rowCopy_;
+  rowCopy_ = model_->clpMatrix()->reverseOrderedCopy();
+  resetRowsDropped();
+  status_ = 0;
+  numberReuses_++;
+  return true;
+}
+// Frees ordering, symbolic and numeric arrays so order can be redone
+void ClpCholeskyBase::freeStructure()
+{
+  delete[] rowsDropped_;
+  rowsDropped_ = NULL;
+  delete[] permuteInverse_;
+  permuteInverse_ = NULL;
+  delete[] permute_;
+  permute_ = NULL;
+  delete[] sparseFactor_;
+  sparseFactor_ = NULL;
+  delete[] choleskyStart_;
+  choleskyStart_ = NULL;
+  delete[] choleskyRow_;
+  choleskyRow_ = NULL;
+  delete[] indexStart_;
+  indexStart_ = NULL;
+  delete[] diagonal_;
+  diagonal_ = NULL;
+  delete[] workDouble_;
+  workDouble_ = NULL;
+  delete[] link_;
+  link_ = NULL;
+  delete[] workInteger_;
+  workInteger_ = NULL;
+  delete[] clique_;
+  clique_ = NULL;
+  delete rowCopy_;
+  rowCopy_ = NULL;
+  delete[] whichDense_;
+  whichDense_ = NULL;
+  delete[] denseColumn_;
+  denseColumn_ = NULL;
+  delete dense_;
+  dense_ = NULL;
+  structureHash_ = 0;
+  delete[] structureStart_;
+  structureStart_ = NULL;
+  delete[] structureRow_;
+  structureRow_ = NULL;
+  numberColumns_ = 0;
+}
+/* Saves ordering and symbolic factorization to file.
+   Returns 0 okay, 1 could not open file, 2 nothing to save or write error */
+int ClpCholeskyBase::saveStructure(const char *fileName) const
+{
+  if (type_ || doKKT_ || !structureHash_ || !permute_ || !choleskyStart_
+    || !structureStart_)
+    return 2;
+  FILE *fp = fopen(fileName, "wb");
+  if (!fp)
+    return 1;
+  int numberColumns = numberColumns_;
+  int numberElements = static_cast< int >(structureStart_[numberColumns]);
+  int numberDenseFlags = whichDense_ ? numberColumns : 0;
+  int header[9];
+  header[0] = 2; // version
+  header[1] = static_cast< int >(sizeof(CoinBigIndex));
+  header[2] = numberRows_;
+  header[3] = numberColumns;
+  header[4] = sizeFactor_;
+  header[5] = sizeIndex_;
+  header[6] = firstDense_;
+  header[7] = whichDense_ ? 1 : 0;
+  header[8] = numberElements;
+  int n = numberRows_;
+  int returnCode = 0;
+  if (fwrite(header, sizeof(int), 9, fp) != 9
+    || fwrite(&structureHash_, sizeof(unsigned int), 1, fp) != 1
+    || fwrite(permute_, sizeof(CoinBigIndex), n, fp) != static_cast< size_t >(n)
+    || fwrite(permuteInverse_, sizeof(CoinBigIndex), n, fp) != static_cast< size_t >(n)
+    || fwrite(choleskyStart_, sizeof(CoinBigIndex), n + 1, fp) != static_cast< size_t >(n + 1)
+    || fwrite(choleskyRow_, sizeof(CoinBigIndex), sizeIndex_, fp) != static_cast< size_t >(sizeIndex_)
+    || fwrite(indexStart_, sizeof(int), n, fp) != static_cast< size_t >(n)
+    || fwrite(clique_, sizeof(int), n, fp) != static_cast< size_t >(n)
+    || fwrite(structureStart_, sizeof(CoinBigIndex), numberColumns + 1, fp) != static_cast< size_t >(numberColumns + 1)
+    || fwrite(structureRow_, sizeof(int), numberElements, fp) != static_cast< size_t >(numberElements)
+    || fwrite(whichDense_, sizeof(char), numberDenseFlags, fp) != static_cast< size_t >(numberDenseFlags))
+    returnCode = 2;
+  fclose(fp);
+  return returnCode;
+}
+/* Restores ordering and symbolic factorization saved by saveStructure.
+   A later solve of a model with same structure skips order and symbolic.
+   Everything is checked so a corrupt file can not cause bad accesses.
+   Returns 0 okay, 1 could not open file, 2 bad format */
+int ClpCholeskyBase::restoreStructure(const char *fileName)
+{
+  if (type_ || doKKT_)
+    return 2;
+  FILE *fp = fopen(fileName, "rb");
+  if (!fp)
+    return 1;
+  int header[9];
+  unsigned int hash;
+  if (fread(header, sizeof(int), 9, fp) != 9 || header[0] != 2
+    || header[1] != static_cast< int >(sizeof(CoinBigIndex))
+    || header[2] <= 0 || header[3] <= 0 || header[4] < 0
+    || header[5] < 0 || header[5] > header[4]
+    || header[6] < 0 || header[6] > header[2]
+    || header[7] < 0 || header[7] > 1 || header[8] < 0
+    || fread(&hash, sizeof(unsigned int), 1, fp) != 1 || !hash) {
+    fclose(fp);
+    return 2;
+  }
+  int n = header[2];
+  int numberColumns = header[3];
+  CoinBigIndex sizeFactor = header[4];
+  CoinBigIndex sizeIndex = header[5];
+  int firstDense = header[6];
+  int numberElements = header[8];
+  CoinBigIndex *permute = new CoinBigIndex[n];
+  CoinBigIndex *permuteInverse = new CoinBigIndex[n];
+  CoinBigIndex *choleskyStart = new CoinBigIndex[n + 1];
+  CoinBigIndex *choleskyRow = new CoinBigIndex[CoinMax(sizeIndex, static_cast< CoinBigIndex >(1))];
+  int *indexStart = new int[n];
+  int *clique = new int[n];
+  CoinBigIndex *structureStart = new CoinBigIndex[numberColumns + 1];
+  int *structureRow = new int[CoinMax(numberElements, 1)];
+  int numberDenseFlags = header[7] ? numberColumns : 0;
+  char *whichDense = numberDenseFlags ? new char[numberDenseFlags] : NULL;
+  bool bad = false;
+  if (fread(permute, sizeof(CoinBigIndex), n, fp) != static_cast< size_t >(n)
+    || fread(permuteInverse, sizeof(CoinBigIndex), n, fp) != static_cast< size_t >(n)
+    || fread(choleskyStart, sizeof(CoinBigIndex), n + 1, fp) != static_cast< size_t >(n + 1)
+    || fread(choleskyRow, sizeof(CoinBigIndex), sizeIndex, fp) != static_cast< size_t >(sizeIndex)
+    || fread(indexStart, sizeof(int), n, fp) != static_cast< size_t >(n)
+    || fread(clique, sizeof(int), n, fp) != static_cast< size_t >(n)
+    || fread(structureStart, sizeof(CoinBigIndex), numberColumns + 1, fp) != static_cast< size_t >(numberColumns + 1)
+    || fread(structureRow, sizeof(int), numberElements, fp) != static_cast< size_t >(numberElements)
+    || fread(whichDense, sizeof(char), numberDenseFlags, fp) != static_cast< size_t >(numberDenseFlags))
+    bad = true;
+  fclose(fp);
+  // permuteInverse must be inverse of permute
+  for (int i = 0; i < n && !bad; i++) {
+    CoinBigIndex iPermute = permute[i];
+    if (iPermute < 0 || iPermute >= n || permuteInverse[iPermute] != i)
+      bad = true;
+  }
+  // starts of factor must increase and fit in sizeFactor
+  if (!bad && choleskyStart[0] != 0)
+    bad = true;
+  for (int i = 0; i < n && !bad; i++) {
+    if (choleskyStart[i + 1] < choleskyStart[i] || choleskyStart[i + 1] > sizeFactor)
+      bad = true;
+  }
+  /* Subscripts of a column may be shared with an earlier column so
+     indexStart does not increase - but all subscripts must be in
+     choleskyRow and be rows after column */
+  for (int i = 0; i < n && !bad; i++) {
+    CoinBigIndex start = indexStart[i];
+    if (start < 0 || start > sizeIndex) {
+      bad = true;
+    } else if (i < firstDense) {
+      CoinBigIndex number = choleskyStart[i + 1] - choleskyStart[i];
+      if (start + number > sizeIndex) {
+        bad = true;
+      } else {
+        for (CoinBigIndex j = start; j < start + number; j++) {
+          if (choleskyRow[j] <= i || choleskyRow[j] >= n) {
+            bad = true;
+            break;
+          }
+        }
+      }
+    }
+  }
+  for (CoinBigIndex j = 0; j < sizeIndex && !bad; j++) {
+    if (choleskyRow[j] < 0 || choleskyRow[j] >= n)
+      bad = true;
+  }
+  // clique sizes count down to 1 and stop before dense part
+  for (int i = 0; i < n && !bad; i++) {
+    int size = clique[i];
+    if (size < 0 || size > firstDense - i)
+      bad = true;
+    else if (size > 1 && clique[i + 1] != size - 1)
+      bad = true;
+  }
+  // pattern of matrix
+  if (!bad && structureStart[0] != 0)
+    bad = true;
+  for (int iColumn = 0; iColumn < numberColumns && !bad; iColumn++) {
+    if (structureStart[iColumn + 1] < structureStart[iColumn]
+      || structureStart[iColumn + 1] > numberElements)
+      bad = true;
+  }
+  if (!bad && structureStart[numberColumns] != numberElements)
+    bad = true;
+  for (int j = 0; j < numberElements && !bad; j++) {
+    if (structureRow[j] < 0 || structureRow[j] >= n)
+      bad = true;
+  }
+  for (int iColumn = 0; iColumn < numberDenseFlags && !bad; iColumn++) {
+    if (whichDense[iColumn] != 0 && whichDense[iColumn] != 1)
+      bad = true;
+  }
+  if (bad) {
+    delete[] permute;
+    delete[] permuteInverse;
+    delete[] choleskyStart;
+    delete[] choleskyRow;
+    delete[] indexStart;
+    delete[] clique;
+    delete[] structureStart;
+    delete[] structureRow;
+    delete[] whichDense;
+    return 2;
+  }
+  // throw away anything there
+  freeStructure();
+  numberRows_ = n;
+  sizeFactor_ = sizeFactor;
+  sizeIndex_ = sizeIndex;
+  firstDense_ = firstDense;
+  permute_ = permute;
+  permuteInverse_ = permuteInverse;
+  choleskyStart_ = choleskyStart;
+  choleskyRow_ = choleskyRow;
+  indexStart_ = indexStart;
+  clique_ = clique;
+  whichDense_ = whichDense;
+  numberColumns_ = numberColumns;
+  structureStart_ = structureStart;
+  structureRow_ = structureRow;
+  // work arrays as symbolic would have left them
+  rowsDropped_ = new char[numberRows_];
+  numberRowsDropped_ = 0;
+  memset(rowsDropped_, 0, numberRows_);
+  link_ = new int[numberRows_];
+  workInteger_ = new int[numberRows_];
+  sparseFactor_ = new longDouble[sizeFactor_];
+#if CLP_LONG_CHOLESKY != 1
+  workDouble_ = new longDouble[numberRows_];
+#else
+  // actually long double
+  workDouble_ = reinterpret_cast< double * >(new CoinWorkDouble[numberRows_]);
+#endif
+  diagonal_ = new longDouble[numberRows_];
+  if (whichDense_) {
+    int numberDense = 0;
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+      numberDense += whichDense_[iColumn];
+    denseColumn_ = new longDouble[numberDense * numberRows_];
+    dense_ = new ClpCholeskyDense();
+    dense_->reserveSpace(NULL, numberDense);
+  }
+  structureHash_ = hash;
+  status_ = 0;
+  return 0;
+}
 // reset numberRowsDropped and rowsDropped.
 void ClpCholeskyBase::resetRowsDropped()
 {
@@ -344,7 +701,7 @@ int ClpCholeskyBase::preOrder(bool lowerTriangular, bool includeDiagonal, bool d
           numberDense++;
         }
       }
-      if (!numberDense || numberDense > 100) {
+      if (!numberDense || numberDense > CLP_MAXIMUM_DENSE_COLUMNS) {
         // free
         delete[] whichDense_;
         whichDense_ = NULL;
@@ -626,6 +983,11 @@ int ClpCholeskyBase::preOrder(bool lowerTriangular, bool includeDiagonal, bool d
   }
   return 0;
 }
+// Number of dense columns kept out of normal equations
+int ClpCholeskyBase::numberDenseColumns() const
+{
+  return dense_ ? dense_->numberRows() : 0;
+}
 /* Orders rows and saves pointer to matrix.and model */
 int ClpCholeskyBase::order(ClpInterior *model)
 {
@@ -707,7 +1069,7 @@ int ClpCholeskyBase::order(ClpInterior *model)
           numberDense++;
         }
       }
-      if (!numberDense || numberDense > 100) {
+      if (!numberDense || numberDense > CLP_MAXIMUM_DENSE_COLUMNS) {
         // free
         delete[] whichDense_;
         whichDense_ = NULL;
@@ -2872,26 +3234,27 @@ int ClpCholeskyBase::factorize(const CoinWorkDouble *diagonal, int *rowsDropped)
       // Zero out dropped rows
       for (i = 0; i < numberDense; i++) {
         longDouble *a = denseColumn_ + i * numberRows_;
-        for (int j = 0; j < numberRows_; j++) {
-          if (rowsDropped[j])
-            a[j] = 0.0;
+        int k;
+        for (k = 0; k < numberRows_; k++) {
+          if (rowsDropped[k])
+            a[k] = 0.0;
         }
-        for (i = 0; i < numberRows_; i++) {
-          int iRow = permute_[i];
-          workDouble_[i] = a[iRow];
+        for (k = 0; k < numberRows_; k++) {
+          int iRow = permute_[k];
+          workDouble_[k] = a[iRow];
         }
-        for (i = 0; i < numberRows_; i++) {
-          CoinWorkDouble value = workDouble_[i];
-          CoinBigIndex offset = indexStart_[i] - choleskyStart_[i];
+        for (k = 0; k < numberRows_; k++) {
+          CoinWorkDouble value = workDouble_[k];
+          CoinBigIndex offset = indexStart_[k] - choleskyStart_[k];
           CoinBigIndex j;
-          for (j = choleskyStart_[i]; j < choleskyStart_[i + 1]; j++) {
+          for (j = choleskyStart_[k]; j < choleskyStart_[k + 1]; j++) {
             int iRow = choleskyRow_[j + offset];
             workDouble_[iRow] -= sparseFactor_[j] * value;
           }
         }
-        for (i = 0; i < numberRows_; i++) {
-          int iRow = permute_[i];
-          a[iRow] = workDouble_[i] * diagonal_[i];
+        for (k = 0; k < numberRows_; k++) {
+          int iRow = permute_[k];
+          a[iRow] = workDouble_[k] * diagonal_[k];
         }
       }
       dense_->resetRowsDropped();
@@ -3252,6 +3615,18 @@ int ClpCholeskyBase::factorize(const CoinWorkDouble *diagonal, int *rowsDropped)
         }
       }
     }
+    // static regularization keeps system quasi-definite
+    CoinWorkDouble primalRegularization = doubleParameters_[40];
+    CoinWorkDouble dualRegularization = doubleParameters_[41];
+    if (primalRegularization || dualRegularization) {
+      for (iRow = 0; iRow < numberRows_; iRow++) {
+        if (permute_[iRow] < numberTotal)
+          diagonal_[iRow] -= primalRegularization;
+        else
+          diagonal_[iRow] = CoinMax(static_cast< CoinWorkDouble >(diagonal_[iRow]),
+            dualRegularization);
+      }
+    }
     //check sizes
     largest *= 1.0e-20;
     largest = CoinMin(largest, CHOL_SMALL_VALUE);
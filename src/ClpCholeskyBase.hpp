@@ -40,6 +40,11 @@ typedef double longDouble;
 typedef double longDouble;
 #define CHOL_SMALL_VALUE 1.0e-11
 #endif
+/* Most dense columns kept out of normal equations and treated by
+   a low rank (Sherman-Morrison-Woodbury) update */
+#ifndef CLP_MAXIMUM_DENSE_COLUMNS
+#define CLP_MAXIMUM_DENSE_COLUMNS 400
+#endif
 class ClpInterior;
 class ClpCholeskyDense;
 class ClpMatrixBase;
@@ -118,6 +123,8 @@ public:
   {
     goDense_ = value;
   }
+  /// Number of dense columns kept out of normal equations
+  int numberDenseColumns() const;
   /// rank.  Returns rank
   inline int rank() const
   {
@@ -158,6 +165,39 @@ public:
   {
     doKKT_ = yesNo;
   }
+  /** Static regularization for KKT - primal block diagonal has
+      primal subtracted and dual block diagonal is at least dual */
+  inline void setKKTRegularization(double primal, double dual)
+  {
+    doubleParameters_[40] = primal;
+    doubleParameters_[41] = dual;
+  }
+  /** Returns true if ordering and symbolic factorization from last
+      solve (or restored) can be used for model (structure has same hash
+      and exactly same pattern).
+      Otherwise frees them so order and symbolic can be redone */
+  bool reuseStructure(ClpInterior *model, unsigned int hash);
+  /** Records structure (hash, sizes and pattern of matrix) of model
+      ordering and symbolic were done for (hash 0 means none) */
+  void setStructure(const ClpInterior *model, unsigned int hash);
+  /// Hash of structure ordering and symbolic were done for (0 none)
+  inline unsigned int structureHash() const
+  {
+    return structureHash_;
+  }
+  /// Number of solves which kept ordering and symbolic factorization
+  inline int numberReuses() const
+  {
+    return numberReuses_;
+  }
+  /** Saves ordering and symbolic factorization (and structure they
+      were done for) to file.  Returns 0 okay, 1 could not open file,
+      2 nothing to save or write error */
+  int saveStructure(const char *fileName) const;
+  /** Restores ordering and symbolic factorization saved by saveStructure
+      so next solve of a model with same structure skips order and symbolic.
+      Returns 0 okay, 1 could not open file, 2 bad format */
+  int restoreStructure(const char *fileName);
   /// Set integer parameter
   inline void setIntegerParameter(int i, int value)
   {
@@ -241,6 +281,8 @@ protected:
      If 1 and 2 then diagonal has sqrt of inverse otherwise inverse
      */
   void solve(CoinWorkDouble *region, int type);
+  /// Frees ordering, symbolic and numeric arrays so order can be redone
+  void freeStructure();
   /// Forms ADAT - returns nonzero if not enough memory
   int preOrder(bool lowerTriangular, bool includeDiagonal, bool doKKT);
   /// Updates dense part (broken out for profiling)
@@ -313,6 +355,16 @@ protected:
   ClpCholeskyDense *dense_;
   /// Dense threshold (for taking out of Cholesky)
   int denseThreshold_;
+  /// Hash of structure ordering and symbolic were done for (0 none)
+  unsigned int structureHash_;
+  /// Number of columns in structure ordering was done for
+  int numberColumns_;
+  /// Column starts (packed) of structure ordering was done for
+  CoinBigIndex *structureStart_;
+  /// Row indices of structure ordering was done for
+  int *structureRow_;
+  /// Number of solves which kept ordering and symbolic factorization
+  int numberReuses_;
   //@}
 };
 
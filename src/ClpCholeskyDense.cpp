@@ -93,6 +93,14 @@ ClpCholeskyBase *ClpCholeskyDense::clone() const
 #define number_blocks(x) (((x) + BLOCK - 1) >> BLOCKSHIFT)
 #define number_rows(x) ((x) << BLOCKSHIFT)
 #define number_entries(x) ((x) << BLOCKSQSHIFT)
+/* Full block kernels using AVX2 when compiled for it (longDouble must be
+   double and BLOCK a multiple of 8) */
+#if defined(__AVX2__) && defined(__FMA__) && !CLP_LONG_CHOLESKY && !COIN_LONG_WORK
+#if (BLOCK & 7) == 0
+#define CLP_CHOLESKY_AVX2
+#include <immintrin.h>
+#endif
+#endif
 /* Gets space */
 int ClpCholeskyDense::reserveSpace(const ClpCholeskyBase *factor, int numberRows)
 {
@@ -1028,6 +1036,58 @@ void ClpCholeskyCrecTriLeaf(/*ClpCholeskyDenseC * thisStruct,*/ longDouble *aUnd
    nUnder is number of rows in iBlock,
    nUnderK is number of rows in kBlock
 */
+#ifdef CLP_CHOLESKY_AVX2
+/* aOther -= aUnder * diag(work) * above' for a full block.
+   Eight rows by four columns of aOther are kept in registers */
+static void ClpCholeskyCrecRecAvx2(const longDouble *COIN_RESTRICT above,
+  const longDouble *COIN_RESTRICT aUnder,
+  longDouble *COIN_RESTRICT aOther,
+  const longDouble *COIN_RESTRICT work)
+{
+  for (int j = 0; j < BLOCK; j += 4) {
+    longDouble *COIN_RESTRICT aa = aOther + j * BLOCK;
+    for (int i = 0; i < BLOCK; i += 8) {
+      __m256d t0a = _mm256_loadu_pd(aa + i + 0 * BLOCK);
+      __m256d t0b = _mm256_loadu_pd(aa + i + 4 + 0 * BLOCK);
+      __m256d t1a = _mm256_loadu_pd(aa + i + 1 * BLOCK);
+      __m256d t1b = _mm256_loadu_pd(aa + i + 4 + 1 * BLOCK);
+      __m256d t2a = _mm256_loadu_pd(aa + i + 2 * BLOCK);
+      __m256d t2b = _mm256_loadu_pd(aa + i + 4 + 2 * BLOCK);
+      __m256d t3a = _mm256_loadu_pd(aa + i + 3 * BLOCK);
+      __m256d t3b = _mm256_loadu_pd(aa + i + 4 + 3 * BLOCK);
+      const longDouble *COIN_RESTRICT aUnderNow = aUnder + i;
+      const longDouble *COIN_RESTRICT aboveNow = above + j;
+      for (int k = 0; k < BLOCK; k++) {
+        __m256d multiplier = _mm256_set1_pd(work[k]);
+        __m256d a0 = _mm256_mul_pd(_mm256_loadu_pd(aUnderNow), multiplier);
+        __m256d a1 = _mm256_mul_pd(_mm256_loadu_pd(aUnderNow + 4), multiplier);
+        __m256d b = _mm256_set1_pd(aboveNow[0]);
+        t0a = _mm256_fnmadd_pd(a0, b, t0a);
+        t0b = _mm256_fnmadd_pd(a1, b, t0b);
+        b = _mm256_set1_pd(aboveNow[1]);
+        t1a = _mm256_fnmadd_pd(a0, b, t1a);
+        t1b = _mm256_fnmadd_pd(a1, b, t1b);
+        b = _mm256_set1_pd(aboveNow[2]);
+        t2a = _mm256_fnmadd_pd(a0, b, t2a);
+        t2b = _mm256_fnmadd_pd(a1, b, t2b);
+        b = _mm256_set1_pd(aboveNow[3]);
+        t3a = _mm256_fnmadd_pd(a0, b, t3a);
+        t3b = _mm256_fnmadd_pd(a1, b, t3b);
+        aUnderNow += BLOCK;
+        aboveNow += BLOCK;
+      }
+      _mm256_storeu_pd(aa + i + 0 * BLOCK, t0a);
+      _mm256_storeu_pd(aa + i + 4 + 0 * BLOCK, t0b);
+      _mm256_storeu_pd(aa + i + 1 * BLOCK, t1a);
+      _mm256_storeu_pd(aa + i + 4 + 1 * BLOCK, t1b);
+      _mm256_storeu_pd(aa + i + 2 * BLOCK, t2a);
+      _mm256_storeu_pd(aa + i + 4 + 2 * BLOCK, t2b);
+      _mm256_storeu_pd(aa + i + 3 * BLOCK, t3a);
+      _mm256_storeu_pd(aa + i + 4 + 3 * BLOCK, t3b);
+    }
+  }
+}
+#endif
 void ClpCholeskyCrecRecLeaf(/*ClpCholeskyDenseC * thisStruct,*/
   const longDouble *COIN_RESTRICT above,
   const longDouble *COIN_RESTRICT aUnder,
@@ -1045,6 +1105,12 @@ void ClpCholeskyCrecRecLeaf(/*ClpCholeskyDenseC * thisStruct,*/
   /*printf("%d %d %d\n",ia,iu,io);*/
   printf("recrecleaf above (%d,%d), under (%d,%d), other (%d,%d)\n",
     ira, ica, iru, icu, iro, ico);
+#endif
+#ifdef CLP_CHOLESKY_AVX2
+  if (nUnder == BLOCK) {
+    ClpCholeskyCrecRecAvx2(above, aUnder, aOther, work);
+    return;
+  }
 #endif
   int i, j, k;
   longDouble *aa;
@@ -1339,6 +1405,23 @@ void ClpCholeskyDense::solveF1(longDouble *a, int n, CoinWorkDouble *region)
 void ClpCholeskyDense::solveF2(longDouble *a, int n, CoinWorkDouble *region, CoinWorkDouble *region2)
 {
   int j, k;
+#ifdef CLP_CHOLESKY_AVX2
+  if (n == BLOCK) {
+    // region2 -= a * region (whole block column in registers)
+    __m256d t[BLOCK / 4];
+    for (k = 0; k < BLOCK / 4; k++)
+      t[k] = _mm256_loadu_pd(region2 + 4 * k);
+    for (j = 0; j < BLOCK; j++) {
+      __m256d value = _mm256_set1_pd(region[j]);
+      const longDouble *COIN_RESTRICT aj = a + j * BLOCK;
+      for (k = 0; k < BLOCK / 4; k++)
+        t[k] = _mm256_fnmadd_pd(value, _mm256_loadu_pd(aj + 4 * k), t[k]);
+    }
+    for (k = 0; k < BLOCK / 4; k++)
+      _mm256_storeu_pd(region2 + 4 * k, t[k]);
+    return;
+  }
+#endif
 #ifdef BLOCKUNROLL
   if (n == BLOCK) {
     for (k = 0; k < BLOCK; k += 4) {
@@ -1464,6 +1547,25 @@ void ClpCholeskyDense::solveB1(longDouble *a, int n, CoinWorkDouble *region)
 void ClpCholeskyDense::solveB2(longDouble *a, int n, CoinWorkDouble *region, CoinWorkDouble *region2)
 {
   int j, k;
+#ifdef CLP_CHOLESKY_AVX2
+  if (n == BLOCK) {
+    // region -= a' * region2 - dot products with region2 in registers
+    __m256d r[BLOCK / 4];
+    for (k = 0; k < BLOCK / 4; k++)
+      r[k] = _mm256_loadu_pd(region2 + 4 * k);
+    for (j = 0; j < BLOCK; j++) {
+      const longDouble *COIN_RESTRICT aj = a + j * BLOCK;
+      __m256d sum = _mm256_mul_pd(r[0], _mm256_loadu_pd(aj));
+      for (k = 1; k < BLOCK / 4; k++)
+        sum = _mm256_fmadd_pd(r[k], _mm256_loadu_pd(aj + 4 * k), sum);
+      __m128d half = _mm_add_pd(_mm256_castpd256_pd128(sum),
+        _mm256_extractf128_pd(sum, 1));
+      half = _mm_add_sd(half, _mm_unpackhi_pd(half, half));
+      region[j] -= _mm_cvtsd_f64(half);
+    }
+    return;
+  }
+#endif
 #ifdef BLOCKUNROLL
   if (n == BLOCK) {
     for (j = 0; j < BLOCK; j += 4) {
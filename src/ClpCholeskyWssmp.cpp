@@ -163,7 +163,7 @@ int ClpCholeskyWssmp::order(ClpInterior *model)
         numberDense++;
       }
     }
-    if (!numberDense || numberDense > 100) {
+    if (!numberDense || numberDense > CLP_MAXIMUM_DENSE_COLUMNS) {
       // free
       delete[] whichDense_;
       whichDense_ = NULL;
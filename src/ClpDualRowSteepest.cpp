@@ -3,6 +3,10 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 #include "CoinPragma.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 #include "ClpSimplex.hpp"
 #include "ClpDualRowSteepest.hpp"
 #include "CoinIndexedVector.hpp"
@@ -402,6 +406,47 @@ static double ft_count_in = 0.0;
 static double up_count_in = 0.0;
 static int xx_count = 0;
 #endif
+// Below this many in updated column weights are updated serially
+#ifndef CLP_DUAL_WEIGHTS_PARALLEL
+#define CLP_DUAL_WEIGHTS_PARALLEL 5000
+#endif
+/* Updates weights for a block of updated column.
+   work/index - updated column, spare - ftran of pivot row,
+   infeas - weights, solution - saved old weights,
+   pivotVariable - pivotColumn if permuted,
+   theta - norm, primalRatio - multiplier, numberAdded - pivot row.
+   Returns alpha (if pivot row in block) in changeObj */
+static void
+updateWeightsBit(clpTempInfo &info)
+{
+  const double *COIN_RESTRICT work = info.work;
+  const int *COIN_RESTRICT which = info.index;
+  const double *COIN_RESTRICT work2 = info.spare;
+  double *COIN_RESTRICT weights = info.infeas;
+  double *COIN_RESTRICT work3 = info.solution;
+  const int *COIN_RESTRICT pivotColumn = info.pivotVariable;
+  double norm = info.theta;
+  double multiplier = info.primalRatio;
+  int pivotRow = info.numberAdded;
+  double alpha = 0.0;
+  int last = info.startColumn + info.numberToDo;
+  for (int i = info.startColumn; i < last; i++) {
+    int iRow = which[i];
+    double theta = work[i];
+    if (iRow == pivotRow)
+      alpha = theta;
+    double devex = weights[iRow];
+    work3[i] = devex; // save old
+    // transform to match spare
+    int jRow = pivotColumn ? pivotColumn[iRow] : iRow;
+    double value = work2[jRow];
+    devex += theta * (theta * norm + value * multiplier);
+    if (devex < DEVEX_TRY_NORM)
+      devex = DEVEX_TRY_NORM;
+    weights[iRow] = devex;
+  }
+  info.changeObj = alpha;
+}
 /* Updates weights and returns pivot alpha.
    Also does FT update */
 double
@@ -542,28 +587,52 @@ ClpDualRowSteepest::updateWeights(CoinIndexedVector *input,
     numberNonZero = updatedColumn->getNumElements();
     which = updatedColumn->getIndices();
 
-    int nSave = 0;
     double *work3 = alternateWeights_->denseVector();
     int *which3 = alternateWeights_->getIndices();
     const int *pivotColumn = model_->factorization()->pivotColumn();
-    for (i = 0; i < numberNonZero; i++) {
-      int iRow = which[i];
-      double theta = work[i];
-      if (iRow == pivotRow)
-        alpha = theta;
-      double devex = weights_[iRow];
-      work3[nSave] = devex; // save old
-      which3[nSave++] = iRow;
-      // transform to match spare
-      int jRow = permute ? pivotColumn[iRow] : iRow;
-      double value = work2[jRow];
-      devex += theta * (theta * norm + value * multiplier);
-      if (devex < DEVEX_TRY_NORM)
-        devex = DEVEX_TRY_NORM;
-      weights_[iRow] = devex;
+    // old weights saved in same order as updated column
+    CoinMemcpyN(which, numberNonZero, which3);
+#if ABOCA_LITE
+    int numberThreads = abcState();
+    if (numberNonZero < CLP_DUAL_WEIGHTS_PARALLEL)
+      numberThreads = 1;
+#define ABOCA_LITE_MAX ABOCA_LITE
+#else
+    int numberThreads = 1;
+#define ABOCA_LITE_MAX 1
+#endif
+    numberThreads = CoinMax(numberThreads, 1);
+    clpTempInfo info[ABOCA_LITE_MAX];
+    int chunk = (numberNonZero + numberThreads - 1) / numberThreads;
+    int n = 0;
+    for (i = 0; i < numberThreads; i++) {
+      info[i].work = work;
+      info[i].index = which;
+      info[i].spare = work2;
+      info[i].infeas = weights_;
+      info[i].solution = work3;
+      info[i].pivotVariable = permute ? pivotColumn : NULL;
+      info[i].theta = norm;
+      info[i].primalRatio = multiplier;
+      info[i].numberAdded = pivotRow;
+      info[i].startColumn = n;
+      info[i].numberToDo = CoinMax(CoinMin(chunk, numberNonZero - n), 0);
+      n += chunk;
+    }
+    if (numberThreads == 1) {
+      updateWeightsBit(info[0]);
+    } else {
+      for (i = 0; i < numberThreads; i++)
+        cilk_spawn updateWeightsBit(info[i]);
+      cilk_sync;
+    }
+#undef ABOCA_LITE_MAX
+    for (i = 0; i < numberThreads; i++) {
+      if (info[i].changeObj)
+        alpha = info[i].changeObj;
     }
     alternateWeights_->setPackedMode(true);
-    alternateWeights_->setNumElements(nSave);
+    alternateWeights_->setNumElements(numberNonZero);
     if (norm < DEVEX_TRY_NORM)
       norm = DEVEX_TRY_NORM;
     // Try this to make less likely will happen again and stop cycling
@@ -1172,6 +1172,16 @@ ClpFactorization::ClpFactorization()
   goSmallThreshold_ = -1;
   doStatistics_ = true;
   memset(&shortestAverage_, 0, 3 * (sizeof(double) + sizeof(int)));
+  hyperSparseMode_ = 0;
+  profile_ = NULL;
+  hyperSparseDensity_ = 0.1;
+  clearHyperSparseStatistics();
+#ifdef CLP_BACKGROUND_FACTORIZATION
+  backgroundPivots_ = 0;
+  background_ = NULL;
+  pivotOffset_ = 0;
+  numberBackgroundUsed_ = 0;
+#endif
 }
 
 //-------------------------------------------------------------------
@@ -1254,6 +1264,19 @@ ClpFactorization::ClpFactorization(const ClpFactorization &rhs,
   factorization_instrument(1);
 #endif
   memcpy(&shortestAverage_, &rhs.shortestAverage_, 3 * (sizeof(double) + sizeof(int)));
+  hyperSparseMode_ = rhs.hyperSparseMode_;
+  profile_ = NULL;
+  hyperSparseDensity_ = rhs.hyperSparseDensity_;
+  memcpy(predictedDensity_, rhs.predictedDensity_, 3 * sizeof(double));
+  memcpy(sumDensity_, rhs.sumDensity_, 3 * sizeof(double));
+  memcpy(numberSparseSolves_, rhs.numberSparseSolves_, 3 * sizeof(int));
+  memcpy(numberDenseSolves_, rhs.numberDenseSolves_, 3 * sizeof(int));
+#ifdef CLP_BACKGROUND_FACTORIZATION
+  backgroundPivots_ = rhs.backgroundPivots_;
+  background_ = NULL;
+  pivotOffset_ = rhs.pivotOffset_;
+  numberBackgroundUsed_ = rhs.numberBackgroundUsed_;
+#endif
 }
 
 ClpFactorization::ClpFactorization(const CoinFactorization &rhs)
@@ -1276,6 +1299,16 @@ ClpFactorization::ClpFactorization(const CoinFactorization &rhs)
   doStatistics_ = true;
   assert(!coinFactorizationA_ || !coinFactorizationB_);
   memset(&shortestAverage_, 0, 3 * (sizeof(double) + sizeof(int)));
+  hyperSparseMode_ = 0;
+  profile_ = NULL;
+  hyperSparseDensity_ = 0.1;
+  clearHyperSparseStatistics();
+#ifdef CLP_BACKGROUND_FACTORIZATION
+  backgroundPivots_ = 0;
+  background_ = NULL;
+  pivotOffset_ = 0;
+  numberBackgroundUsed_ = 0;
+#endif
 }
 
 ClpFactorization::ClpFactorization(const CoinOtherFactorization &rhs)
@@ -1299,6 +1332,16 @@ ClpFactorization::ClpFactorization(const CoinOtherFactorization &rhs)
 #endif
   assert(!coinFactorizationA_ || !coinFactorizationB_);
   memset(&shortestAverage_, 0, 3 * (sizeof(double) + sizeof(int)));
+  hyperSparseMode_ = 0;
+  profile_ = NULL;
+  hyperSparseDensity_ = 0.1;
+  clearHyperSparseStatistics();
+#ifdef CLP_BACKGROUND_FACTORIZATION
+  backgroundPivots_ = 0;
+  background_ = NULL;
+  pivotOffset_ = 0;
+  numberBackgroundUsed_ = 0;
+#endif
 }
 
 //-------------------------------------------------------------------
@@ -1306,6 +1349,9 @@ ClpFactorization::ClpFactorization(const CoinOtherFactorization &rhs)
 //-------------------------------------------------------------------
 ClpFactorization::~ClpFactorization()
 {
+#ifdef CLP_BACKGROUND_FACTORIZATION
+  deleteBackground();
+#endif
 #ifndef SLIM_CLP
   delete networkBasis_;
 #endif
@@ -1339,6 +1385,20 @@ ClpFactorization::operator=(const ClpFactorization &rhs)
     goSmallThreshold_ = rhs.goSmallThreshold_;
     doStatistics_ = rhs.doStatistics_;
     memcpy(&shortestAverage_, &rhs.shortestAverage_, 3 * (sizeof(double) + sizeof(int)));
+    hyperSparseMode_ = rhs.hyperSparseMode_;
+    // profile belongs to model which set it (may have gone)
+    profile_ = NULL;
+    hyperSparseDensity_ = rhs.hyperSparseDensity_;
+    memcpy(predictedDensity_, rhs.predictedDensity_, 3 * sizeof(double));
+    memcpy(sumDensity_, rhs.sumDensity_, 3 * sizeof(double));
+    memcpy(numberSparseSolves_, rhs.numberSparseSolves_, 3 * sizeof(int));
+    memcpy(numberDenseSolves_, rhs.numberDenseSolves_, 3 * sizeof(int));
+#ifdef CLP_BACKGROUND_FACTORIZATION
+    deleteBackground();
+    backgroundPivots_ = rhs.backgroundPivots_;
+    pivotOffset_ = rhs.pivotOffset_;
+    numberBackgroundUsed_ = rhs.numberBackgroundUsed_;
+#endif
     if (rhs.coinFactorizationA_) {
       if (coinFactorizationA_)
         *coinFactorizationA_ = *(rhs.coinFactorizationA_);
@@ -2024,6 +2084,20 @@ scaledDense,scaledDense_2,scaledL,scaledR,scaledU\n");
     coinFactorizationA_->areaFactor(coinFactorizationA_->areaFactor() * 1.1);
   }
   //int numberPivots=coinFactorizationA_->pivots();
+#ifdef CLP_BACKGROUND_FACTORIZATION
+  pivotOffset_ = 0;
+  if (background_) {
+    // Use factors from helper thread if pivots since can be replayed
+    bool done = solveType == 1 && !valuesPass && useBackground(model);
+    deleteBackground();
+    if (done) {
+#ifdef CLP_FACTORIZATION_INSTRUMENT
+      factorization_instrument(2);
+#endif
+      return 0;
+    }
+  }
+#endif
 #if 0
      if (model->algorithm() > 0)
           numberSave = -1;
@@ -2627,6 +2701,10 @@ int ClpFactorization::replaceColumn(const ClpSimplex *model,
     // see if FT
     if (!coinFactorizationA_ || coinFactorizationA_->forrestTomlin()) {
       if (coinFactorizationA_) {
+#ifdef CLP_BACKGROUND_FACTORIZATION
+        if (backgroundPivots_ && !background_ && pivots() == backgroundPivots_ && model->clpMatrix()->type() == 1)
+          startBackground(model);
+#endif
 #if ABC_USE_COIN_FACTORIZATION < 2
         returnCode = coinFactorizationA_->replaceColumn(regionSparse,
           pivotRow,
@@ -2647,6 +2725,22 @@ int ClpFactorization::replaceColumn(const ClpSimplex *model,
           coinFactorizationA_->replaceColumnPart3(regionSparse,
             pivotRow,
             model->alpha());
+#endif
+#ifdef CLP_BACKGROUND_FACTORIZATION
+        if (background_ && returnCode < 2) {
+          // remember pivot so can be replayed on background factors
+          ClpBackgroundFactorization *background = background_;
+          if (background->numberPivots < background->maximumPivots) {
+            background->sequenceIn[background->numberPivots] = model->sequenceIn();
+            background->sequenceOut[background->numberPivots++] = model->sequenceOut();
+          } else {
+            background->invalid = 1;
+          }
+        }
+        if (pivotOffset_ && returnCode < 2 && coinFactorizationA_->pivots() >= coinFactorizationA_->maximumPivots()) {
+          // replayed pivots have used up space for updates - pivot taken but factorize now
+          returnCode = 5;
+        }
 #endif
       } else {
         bool tab = coinFactorizationB_->wantsTableauColumn();
@@ -2728,6 +2822,7 @@ int ClpFactorization::updateColumnFT(CoinIndexedVector *regionSparse,
 #endif
   if (!numberRows())
     return 0;
+  ClpProfileTimer timer(profile_, ClpProfileFtran);
 #ifndef SLIM_CLP
   if (!networkBasis_) {
 #endif
@@ -2736,10 +2831,12 @@ int ClpFactorization::updateColumnFT(CoinIndexedVector *regionSparse,
 #endif
     int returnCode;
     if (coinFactorizationA_) {
+      int saveThreshold = predictSparse(1);
       coinFactorizationA_->setCollectStatistics(true);
       returnCode = coinFactorizationA_->updateColumnFT(regionSparse,
         regionSparse2);
       coinFactorizationA_->setCollectStatistics(false);
+      recordSparse(1, saveThreshold, regionSparse2);
     } else {
 #ifdef CLP_REUSE_ETAS
       int tempInfo[2];
@@ -2810,6 +2907,7 @@ int ClpFactorization::updateColumn(CoinIndexedVector *regionSparse,
 #endif
   if (!numberRows())
     return 0;
+  ClpProfileTimer timer(profile_, ClpProfileFtran);
 #ifndef SLIM_CLP
   if (!networkBasis_) {
 #endif
@@ -2818,11 +2916,13 @@ int ClpFactorization::updateColumn(CoinIndexedVector *regionSparse,
 #endif
     int returnCode;
     if (coinFactorizationA_) {
+      int saveThreshold = predictSparse(0);
       coinFactorizationA_->setCollectStatistics(doStatistics_);
       returnCode = coinFactorizationA_->updateColumn(regionSparse,
         regionSparse2,
         noPermute);
       coinFactorizationA_->setCollectStatistics(false);
+      recordSparse(0, saveThreshold, regionSparse2);
     } else {
       returnCode = coinFactorizationB_->updateColumn(regionSparse,
         regionSparse2,
@@ -2896,6 +2996,7 @@ int ClpFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
 #endif
   if (!numberRows())
     return 0;
+  ClpProfileTimer timer(profile_, ClpProfileFtran);
   int returnCode = 0;
 #ifndef SLIM_CLP
   if (!networkBasis_) {
@@ -2904,6 +3005,7 @@ int ClpFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
     factorization_instrument(-1);
 #endif
     if (coinFactorizationA_) {
+      int saveThreshold = predictSparse(1);
       coinFactorizationA_->setCollectStatistics(true);
       if (coinFactorizationA_->spaceForForrestTomlin()) {
         assert(regionSparse2->packedMode());
@@ -2920,6 +3022,7 @@ int ClpFactorization::updateTwoColumnsFT(CoinIndexedVector *regionSparse1,
           noPermuteRegion3);
       }
       coinFactorizationA_->setCollectStatistics(false);
+      recordSparse(1, saveThreshold, regionSparse2);
     } else {
 #if 0
                CoinSimpFactorization * fact =
@@ -2995,6 +3098,7 @@ int ClpFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
 {
   if (!numberRows())
     return 0;
+  ClpProfileTimer timer(profile_, ClpProfileBtran);
 #ifndef SLIM_CLP
   if (!networkBasis_) {
 #endif
@@ -3004,10 +3108,12 @@ int ClpFactorization::updateColumnTranspose(CoinIndexedVector *regionSparse,
     int returnCode;
 
     if (coinFactorizationA_) {
+      int saveThreshold = predictSparse(2);
       coinFactorizationA_->setCollectStatistics(doStatistics_);
       returnCode = coinFactorizationA_->updateColumnTranspose(regionSparse,
         regionSparse2);
       coinFactorizationA_->setCollectStatistics(false);
+      recordSparse(2, saveThreshold, regionSparse2);
     } else {
       returnCode = coinFactorizationB_->updateColumnTranspose(regionSparse,
         regionSparse2);
@@ -3072,6 +3178,7 @@ void ClpFactorization::updateTwoColumnsTranspose(CoinIndexedVector *regionSparse
 {
   if (!numberRows())
     return;
+  ClpProfileTimer timer(profile_, ClpProfileBtran);
 #ifndef SLIM_CLP
   if (!networkBasis_) {
 #endif
@@ -3079,6 +3186,7 @@ void ClpFactorization::updateTwoColumnsTranspose(CoinIndexedVector *regionSparse
     factorization_instrument(-1);
 #endif
     if (coinFactorizationA_) {
+      int saveThreshold = predictSparse(2);
       coinFactorizationA_->setCollectStatistics(doStatistics_);
 #if ABOCA_LITE_FACTORIZATION
       coinFactorizationA_->updateTwoColumnsTranspose(regionSparse,
@@ -3088,6 +3196,7 @@ void ClpFactorization::updateTwoColumnsTranspose(CoinIndexedVector *regionSparse
         regionSparse2, regionSparse3, 0);
 #endif
       coinFactorizationA_->setCollectStatistics(false);
+      recordSparse(2, saveThreshold, regionSparse2);
     } else {
       coinFactorizationB_->updateColumnTranspose(regionSparse,
         regionSparse2);
@@ -3121,6 +3230,318 @@ void ClpFactorization::goSparse()
     }
   }
 }
+// Set hyper-sparse mode
+void ClpFactorization::setHyperSparseMode(int value)
+{
+  hyperSparseMode_ = value;
+  clearHyperSparseStatistics();
+}
+// Clears hyper-sparse statistics and predictions
+void ClpFactorization::clearHyperSparseStatistics()
+{
+  for (int i = 0; i < 3; i++) {
+    predictedDensity_[i] = 0.0;
+    sumDensity_[i] = 0.0;
+    numberSparseSolves_[i] = 0;
+    numberDenseSolves_[i] = 0;
+  }
+}
+// Statistics for hyper-sparse mode
+void ClpFactorization::hyperSparseStatistics(int type, int &numberSparse,
+  int &numberDense, double &averageDensity) const
+{
+  assert(type >= 0 && type < 3);
+  numberSparse = numberSparseSolves_[type];
+  numberDense = numberDenseSolves_[type];
+  int numberSolves = numberSparse + numberDense;
+  averageDensity = numberSolves ? sumDensity_[type] / numberSolves : 0.0;
+}
+/* Sets sparse threshold in coinFactorizationA_ for a solve of
+   given type.  Returns threshold to restore or -1 if not changed */
+int ClpFactorization::predictSparse(int type) const
+{
+  if (!hyperSparseMode_)
+    return -1;
+  int saveThreshold = coinFactorizationA_->sparseThreshold();
+  // no row copy of L so can't go sparse
+  if (saveThreshold <= 0)
+    return -1;
+  if (predictedDensity_[type] < hyperSparseDensity_) {
+    // a large threshold means sparse code is always chosen
+    coinFactorizationA_->sparseThreshold(coinFactorizationA_->numberRows());
+    numberSparseSolves_[type]++;
+  } else {
+    coinFactorizationA_->sparseThreshold(1);
+    numberDenseSolves_[type]++;
+  }
+  return saveThreshold;
+}
+// Records density of result and restores threshold
+void ClpFactorization::recordSparse(int type, int saveThreshold,
+  const CoinIndexedVector *result) const
+{
+  if (saveThreshold < 0)
+    return;
+  coinFactorizationA_->sparseThreshold(saveThreshold);
+  int numberRows = CoinMax(coinFactorizationA_->numberRows(), 1);
+  double density = static_cast< double >(result->getNumElements()) / numberRows;
+  sumDensity_[type] += density;
+  if (numberSparseSolves_[type] + numberDenseSolves_[type] > 1)
+    predictedDensity_[type] = 0.9 * predictedDensity_[type] + 0.1 * density;
+  else
+    predictedDensity_[type] = density;
+}
+#ifdef CLP_BACKGROUND_FACTORIZATION
+#include <pthread.h>
+struct ClpBackgroundFactorization {
+  pthread_t thread;
+  /// Factorization being done by helper thread
+  CoinFactorization *factorization;
+  /// Model basis was taken from
+  const ClpSimplex *model;
+  /// Basis as given to factorization - row basics first
+  int *pivotTemp;
+  int numberRowBasic;
+  /// Elements in U at start
+  int numberElements;
+  /// Pivots done since basis taken
+  int *sequenceIn;
+  int *sequenceOut;
+  int numberPivots;
+  int maximumPivots;
+  /// Nonzero if pivots can not be replayed
+  int invalid;
+  /// Nonzero if thread not yet joined
+  int running;
+};
+static void *clpBackgroundFactor(void *info)
+{
+  ClpBackgroundFactorization *background = reinterpret_cast< ClpBackgroundFactorization * >(info);
+  CoinFactorization *factorization = background->factorization;
+  if (factorization->biasLU() >= 3 || factorization->numberRows() != factorization->numberColumns())
+    factorization->preProcess(2);
+  else
+    factorization->preProcess(3); // no row copy
+  factorization->factor();
+  return NULL;
+}
+// Set pivots at which background refactorization starts (0 off)
+void ClpFactorization::setBackgroundPivots(int value)
+{
+  deleteBackground();
+  backgroundPivots_ = value;
+}
+// Starts helper thread factorizing current basis of model
+void ClpFactorization::startBackground(const ClpSimplex *model)
+{
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+  const int *pivotVariable = model->pivotVariable();
+  int *pivotTemp = new int[numberRows];
+  // Same order as factorize - slacks first
+  int numberRowBasic = 0;
+  for (int i = 0; i < numberRows; i++) {
+    int iPivot = pivotVariable[i];
+    if (iPivot >= numberColumns)
+      pivotTemp[numberRowBasic++] = iPivot - numberColumns;
+  }
+  int numberBasic = numberRowBasic;
+  for (int i = 0; i < numberRows; i++) {
+    int iPivot = pivotVariable[i];
+    if (iPivot >= 0 && iPivot < numberColumns)
+      pivotTemp[numberBasic++] = iPivot;
+  }
+  if (numberBasic != numberRows) {
+    // not full basis
+    delete[] pivotTemp;
+    return;
+  }
+  ClpMatrixBase *matrix = model->clpMatrix();
+  int maximumPivots = coinFactorizationA_->maximumPivots();
+  // Copy so all settings (tolerances, slack value, sparse threshold etc) are kept
+  // then empty as factorize does
+  CoinFactorization *factorization = new CoinFactorization(*coinFactorizationA_);
+  factorization->gutsOfDestructor();
+  factorization->gutsOfInitialize(2);
+  int numberColumnBasic = numberBasic - numberRowBasic;
+  int numberElements = numberRowBasic + matrix->countBasis(pivotTemp + numberRowBasic, numberColumnBasic);
+  numberElements = 3 * numberBasic + 3 * numberElements + 20000;
+  factorization->getAreas(numberRows, numberBasic, numberElements,
+    2 * numberElements);
+  // Fill in counts so we can skip part of preProcess
+  int *numberInRow = factorization->numberInRow();
+  int *numberInColumn = factorization->numberInColumn();
+  CoinZeroN(numberInRow, factorization->numberRows() + 1);
+  CoinZeroN(numberInColumn, factorization->maximumColumnsExtra() + 1);
+  CoinFactorizationDouble *elementU = factorization->elementU();
+  int *indexRowU = factorization->indexRowU();
+  int *startColumnU = factorization->startColumnU();
+#ifndef COIN_FAST_CODE
+  double slackValue = factorization->slackValue();
+#endif
+  for (int i = 0; i < numberRowBasic; i++) {
+    int iRow = pivotTemp[i];
+    indexRowU[i] = iRow;
+    startColumnU[i] = i;
+    elementU[i] = slackValue;
+    numberInRow[iRow] = 1;
+    numberInColumn[i] = 1;
+  }
+  startColumnU[numberRowBasic] = numberRowBasic;
+  // fillBasis only reads model
+  matrix->fillBasis(const_cast< ClpSimplex * >(model),
+    pivotTemp + numberRowBasic,
+    numberColumnBasic,
+    indexRowU,
+    startColumnU + numberRowBasic,
+    numberInRow,
+    numberInColumn + numberRowBasic,
+    elementU);
+  numberElements = startColumnU[numberBasic - 1]
+    + numberInColumn[numberBasic - 1];
+  factorization->setNumberElementsU(numberElements);
+  ClpBackgroundFactorization *background = new ClpBackgroundFactorization;
+  background->factorization = factorization;
+  background->model = model;
+  background->pivotTemp = pivotTemp;
+  background->numberRowBasic = numberRowBasic;
+  background->numberElements = numberElements;
+  background->sequenceIn = new int[2 * maximumPivots];
+  background->sequenceOut = background->sequenceIn + maximumPivots;
+  background->numberPivots = 0;
+  background->maximumPivots = maximumPivots;
+  background->invalid = 0;
+  background->running = 1;
+  background_ = background;
+  if (pthread_create(&background->thread, NULL, clpBackgroundFactor, background)) {
+    background->running = 0;
+    deleteBackground();
+  }
+}
+/* Tries to use background factorization - replays pivots done
+   since it was started and sets pivotVariable.
+   Returns true if successful */
+bool ClpFactorization::useBackground(ClpSimplex *model)
+{
+  ClpBackgroundFactorization *background = background_;
+  if (background->running) {
+    pthread_join(background->thread, NULL);
+    background->running = 0;
+  }
+  CoinFactorization *factorization = background->factorization;
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+  if (background->invalid || background->model != model || factorization->status() || factorization->numberRows() != numberRows)
+    return false;
+  // See if worth going sparse and when
+  factorization->checkSparse();
+  const int *permuteBack = factorization->permuteBack();
+  const int *back = factorization->pivotColumnBack();
+  const int *pivotTemp = background->pivotTemp;
+  int numberRowBasic = background->numberRowBasic;
+  int numberTotal = numberRows + numberColumns;
+  int *pivotNew = new int[numberRows + numberTotal];
+  int *whichRow = pivotNew + numberRows;
+  // Redo pivot order as factorize would have done
+  for (int i = 0; i < numberRows; i++) {
+    int k = pivotTemp[i];
+    if (i < numberRowBasic)
+      k += numberColumns;
+    pivotNew[permuteBack[back[i]]] = k;
+  }
+  ClpDisjointCopyN(factorization->permute(), numberRows, factorization->pivotColumn());
+  ClpDisjointCopyN(factorization->permuteBack(), numberRows, factorization->pivotColumnBack());
+  CoinFillN(whichRow, numberTotal, -1);
+  for (int i = 0; i < numberRows; i++)
+    whichRow[pivotNew[i]] = i;
+  // Replay pivots done while factorizing
+  bool good = true;
+  CoinIndexedVector region1(2 * numberRows + background->maximumPivots);
+  CoinIndexedVector region2(2 * numberRows + background->maximumPivots);
+  for (int iPivot = 0; iPivot < background->numberPivots; iPivot++) {
+    int sequenceIn = background->sequenceIn[iPivot];
+    int sequenceOut = background->sequenceOut[iPivot];
+    if (sequenceIn < 0 || sequenceIn >= numberTotal || sequenceOut < 0 || sequenceOut >= numberTotal) {
+      good = false;
+      break;
+    }
+    int iRow = whichRow[sequenceOut];
+    if (iRow < 0 || whichRow[sequenceIn] >= 0) {
+      good = false;
+      break;
+    }
+    model->unpackPacked(&region2, sequenceIn);
+    factorization->updateColumnFT(&region1, &region2);
+    // result is packed
+    const int *index = region2.getIndices();
+    const double *element = region2.denseVector();
+    int number = region2.getNumElements();
+    double alpha = 0.0;
+    for (int j = 0; j < number; j++) {
+      if (index[j] == iRow) {
+        alpha = element[j];
+        break;
+      }
+    }
+    int returnCode = 3;
+    if (fabs(alpha) > 1.0e-8)
+      returnCode = factorization->replaceColumn(&region1, iRow, alpha, false, 1.0e-8);
+    region1.clear();
+    region2.clear();
+    if (returnCode >= 2) {
+      good = false;
+      break;
+    }
+    whichRow[sequenceOut] = -1;
+    whichRow[sequenceIn] = iRow;
+    pivotNew[iRow] = sequenceIn;
+  }
+  if (good) {
+    // Must agree with status
+    int numberBasic = 0;
+    for (int i = 0; i < numberTotal; i++) {
+      if (model->getStatus(i) == ClpSimplex::basic) {
+        numberBasic++;
+        if (whichRow[i] < 0)
+          good = false;
+      }
+    }
+    if (numberBasic != numberRows)
+      good = false;
+  }
+  if (good) {
+    CoinMemcpyN(pivotNew, numberRows, model->pivotVariable());
+    delete coinFactorizationA_;
+    coinFactorizationA_ = factorization;
+    background->factorization = NULL;
+    // replayed pivots are not counted so caller sees fresh factorization
+    pivotOffset_ = background->numberPivots;
+    numberBackgroundUsed_++;
+#ifdef CLP_FACTORIZATION_NEW_TIMING
+    lastNumberPivots_ = 0;
+    effectiveStartNumberU_ = background->numberElements - numberRows;
+    endLengthU_ = factorization->numberElements() - factorization->numberDense() * factorization->numberDense()
+      - factorization->numberElementsL();
+#endif
+  }
+  delete[] pivotNew;
+  return good;
+}
+// Waits for and deletes any background factorization
+void ClpFactorization::deleteBackground()
+{
+  ClpBackgroundFactorization *background = background_;
+  if (!background)
+    return;
+  if (background->running)
+    pthread_join(background->thread, NULL);
+  delete background->factorization;
+  delete[] background->pivotTemp;
+  delete[] background->sequenceIn;
+  delete background;
+  background_ = NULL;
+}
+#endif
 // Cleans up i.e. gets rid of network basis
 void ClpFactorization::cleanUp()
 {
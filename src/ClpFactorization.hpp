@@ -13,6 +13,9 @@ class ClpMatrixBase;
 class ClpSimplex;
 class ClpNetworkBasis;
 class CoinOtherFactorization;
+#ifdef CLP_BACKGROUND_FACTORIZATION
+struct ClpBackgroundFactorization;
+#endif
 #ifndef CLP_MULTIPLE_FACTORIZATIONS
 #define CLP_MULTIPLE_FACTORIZATIONS 4
 #endif
@@ -189,7 +192,11 @@ public:
   inline int pivots() const
   {
     if (coinFactorizationA_)
+#ifndef CLP_BACKGROUND_FACTORIZATION
       return coinFactorizationA_->pivots();
+#else
+      return coinFactorizationA_->pivots() - pivotOffset_;
+#endif
     else
       return coinFactorizationB_->pivots();
   }
@@ -239,6 +246,56 @@ public:
     if (coinFactorizationA_)
       coinFactorizationA_->sparseThreshold(value);
   }
+  /** Hyper-sparse mode.
+      0 - sparse or dense solves chosen by static sparseThreshold (default)
+      1 - choose per call from measured density of earlier results
+      of same type (ftran, ftranFT, btran) */
+  inline int hyperSparseMode() const
+  {
+    return hyperSparseMode_;
+  }
+  /// Set hyper-sparse mode (see hyperSparseMode())
+  void setHyperSparseMode(int value);
+  /// Density (fraction of rows) below which predicted results go sparse
+  inline double hyperSparseDensity() const
+  {
+    return hyperSparseDensity_;
+  }
+  inline void setHyperSparseDensity(double value)
+  {
+    hyperSparseDensity_ = value;
+  }
+  /** Statistics for hyper-sparse mode.
+      type 0 ftran, 1 ftranFT, 2 btran.
+      Returns number of calls done sparse and dense and average
+      density of results */
+  void hyperSparseStatistics(int type, int &numberSparse,
+    int &numberDense, double &averageDensity) const;
+  /// Clears hyper-sparse statistics and predictions
+  void clearHyperSparseStatistics();
+  /// Sets where FTRAN and BTRAN timings go (NULL to switch off)
+  inline void setProfile(ClpProfile *profile)
+  {
+    profile_ = profile;
+  }
+#ifdef CLP_BACKGROUND_FACTORIZATION
+  /** Background refactorization.
+      If nonzero then after this many pivots a helper thread factorizes
+      a copy of the current basis while iterations continue.  At the
+      next factorize the pivots done since are replayed as updates on
+      the fresh factors instead of factorizing from scratch. */
+  inline int backgroundPivots() const
+  {
+    return backgroundPivots_;
+  }
+  /// Set pivots at which background refactorization starts (0 off)
+  void setBackgroundPivots(int value);
+  /// Number of times factors from helper thread were used
+  inline int numberBackgroundUsed() const
+  {
+    return numberBackgroundUsed_;
+  }
+#endif
   /// Returns status
   inline int status() const
   {
@@ -510,6 +567,32 @@ public:
   void getWeights(int *weights) const;
   //@}
 
+private:
+#ifdef CLP_MULTIPLE_FACTORIZATIONS
+  /**@name hyper-sparse prediction */
+  //@{
+  /** Sets sparse threshold in coinFactorizationA_ for a solve of
+      given type.  Returns threshold to restore or -1 if not changed */
+  int predictSparse(int type) const;
+  /// Records density of result and restores threshold
+  void recordSparse(int type, int saveThreshold,
+    const CoinIndexedVector *result) const;
+  //@}
+#ifdef CLP_BACKGROUND_FACTORIZATION
+  /**@name background refactorization */
+  //@{
+  /// Starts helper thread factorizing current basis of model
+  void startBackground(const ClpSimplex *model);
+  /** Tries to use background factorization - replays pivots done
+      since it was started and sets pivotVariable.
+      Returns true if successful */
+  bool useBackground(ClpSimplex *model);
+  /// Waits for and deletes any background factorization
+  void deleteBackground();
+  //@}
+#endif
+#endif
+
   ////////////////// data //////////////////
 private:
   /**@name data */
@@ -535,6 +618,31 @@ private:
   int goSmallThreshold_;
   /// Switch to dense if number rows <= this
   int goDenseThreshold_;
+  /// Phase timings of owning model (not owned, NULL if not profiling)
+  ClpProfile *profile_;
+  /// Hyper-sparse mode 0 static, 1 predicted
+  int hyperSparseMode_;
+  /// Density below which predicted results go sparse
+  double hyperSparseDensity_;
+  /// Predicted result density for ftran, ftranFT, btran
+  mutable double predictedDensity_[3];
+  /// Sum of result densities for ftran, ftranFT, btran
+  mutable double sumDensity_[3];
+  /// Number of solves done sparse for ftran, ftranFT, btran
+  mutable int numberSparseSolves_[3];
+  /// Number of solves done dense for ftran, ftranFT, btran
+  mutable int numberDenseSolves_[3];
+#ifdef CLP_BACKGROUND_FACTORIZATION
+  /// Pivots at which background refactorization starts (0 off)
+  int backgroundPivots_;
+  /// Background factorization (NULL if none running)
+  ClpBackgroundFactorization *background_;
+  /** Pivots replayed on factors from helper thread - these are
+      in coinFactorizationA_ but pivots() starts again from zero */
+  int pivotOffset_;
+  /// Number of times factors from helper thread were used
+  int numberBackgroundUsed_;
+#endif
 #endif
 #ifdef CLP_FACTORIZATION_NEW_TIMING
   /// For guessing when to re-factorize
@@ -104,6 +104,8 @@ ClpInterior::ClpInterior()
   , gonePrimalFeasible_(false)
   , goneDualFeasible_(false)
   , algorithm_(-1)
+  , warmStart_(0.0)
+  , correctorLimit_(0)
 {
   memset(historyInfeasibility_, 0, LENGTH_HISTORY * sizeof(CoinWorkDouble));
   solveType_ = 3; // say interior based life form
@@ -193,6 +195,8 @@ ClpInterior::ClpInterior(const ClpModel *rhs,
   , gonePrimalFeasible_(false)
   , goneDualFeasible_(false)
   , algorithm_(-1)
+  , warmStart_(0.0)
+  , correctorLimit_(0)
 {
   memset(historyInfeasibility_, 0, LENGTH_HISTORY * sizeof(CoinWorkDouble));
   solveType_ = 3; // say interior based life form
@@ -345,6 +349,8 @@ ClpInterior::ClpInterior(const ClpModel &rhs)
   , gonePrimalFeasible_(false)
   , goneDualFeasible_(false)
   , algorithm_(-1)
+  , warmStart_(0.0)
+  , correctorLimit_(0)
 {
   memset(historyInfeasibility_, 0, LENGTH_HISTORY * sizeof(CoinWorkDouble));
   solveType_ = 3; // say interior based life form
@@ -441,6 +447,8 @@ void ClpInterior::gutsOfCopy(const ClpInterior &rhs)
   gonePrimalFeasible_ = rhs.gonePrimalFeasible_;
   goneDualFeasible_ = rhs.goneDualFeasible_;
   algorithm_ = rhs.algorithm_;
+  warmStart_ = rhs.warmStart_;
+  correctorLimit_ = rhs.correctorLimit_;
 }
 
 void ClpInterior::gutsOfDelete()
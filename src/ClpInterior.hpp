@@ -50,7 +50,7 @@ typedef struct {
   double x0min;
   double z0min;
   double mu0;
-  int LSmethod; // 1=Cholesky    2=QR    3=LSQR
+  int LSmethod; // 1=Cholesky    2=QR    3=LSQR    4=PCG (CGLS)
   int LSproblem; // See below
   int LSQRMaxIter;
   double LSQRatol1; // Initial  atol
@@ -277,8 +277,42 @@ public:
   {
     maximumBarrierIterations_ = value;
   }
+  /** Warm start.  If nonzero next solve starts from current primal and
+      dual solution (e.g. of a closely related problem) pushed this
+      relative distance into interior.  Ordering and symbolic
+      factorization are kept if structure of matrix is unchanged */
+  inline double warmStart() const
+  {
+    return warmStart_;
+  }
+  inline void setWarmStart(double value)
+  {
+    warmStart_ = value;
+  }
+  /** Centrality correctors allowed each iteration.
+      0 (default) decides from cost of factorize relative to a solve */
+  inline int correctorLimit() const
+  {
+    return correctorLimit_;
+  }
+  inline void setCorrectorLimit(int value)
+  {
+    correctorLimit_ = value;
+  }
   /// Set cholesky (and delete present one)
   void setCholesky(ClpCholeskyBase *cholesky);
+  /// Return cholesky (e.g. to save ordering and symbolic structure)
+  inline ClpCholeskyBase *cholesky() const
+  {
+    return cholesky_;
+  }
+  /// Take cholesky out of model without deleting it (caller owns it)
+  inline ClpCholeskyBase *releaseCholesky()
+  {
+    ClpCholeskyBase *cholesky = cholesky_;
+    cholesky_ = NULL;
+    return cholesky;
+  }
   /// Return number fixed to see if worth presolving
   int numberFixed() const;
   /** fix variables interior says should be.  If reallyFix false then just
@@ -601,6 +635,10 @@ protected:
   bool goneDualFeasible_;
   /// Which algorithm being used
   int algorithm_;
+  /// Warm start distance into interior (0.0 is cold start)
+  double warmStart_;
+  /// Centrality correctors allowed (0 automatic)
+  int correctorLimit_;
   //@}
 };
 //#############################################################################
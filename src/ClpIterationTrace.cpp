@@ -0,0 +1,116 @@
+// Copyright (C) 2026, COIN-OR Foundation and others. All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+
+#include "ClpIterationTrace.hpp"
+#include <cstring>
+#include <atomic>
+
+struct ClpIterationTraceIndices {
+  /// Next slot producer writes (only changed by producer)
+  std::atomic< int > head;
+  /// Next slot consumer reads (only changed by consumer)
+  std::atomic< int > tail;
+  /// Records dropped as buffer full (only changed by producer)
+  std::atomic< int > numberDropped;
+};
+
+//#############################################################################
+// Constructors / Destructor
+//#############################################################################
+
+ClpIterationTrace::ClpIterationTrace(int size, int frequency)
+  : size_(CoinMax(size, 2))
+  , frequency_(CoinMax(frequency, 1))
+{
+  records_ = new ClpIterationRecord[size_];
+  indices_ = new ClpIterationTraceIndices;
+  indices_->head.store(0, std::memory_order_relaxed);
+  indices_->tail.store(0, std::memory_order_relaxed);
+  indices_->numberDropped.store(0, std::memory_order_relaxed);
+  memset(&pending_, 0, sizeof(ClpIterationRecord));
+}
+
+ClpIterationTrace::~ClpIterationTrace()
+{
+  delete[] records_;
+  delete indices_;
+}
+// Adds pending record (dropped if buffer full) and clears it
+void ClpIterationTrace::add()
+{
+  int head = indices_->head.load(std::memory_order_relaxed);
+  int next = head + 1;
+  if (next == size_)
+    next = 0;
+  // acquire so consumer has finished reading slot before it is reused
+  if (next != indices_->tail.load(std::memory_order_acquire)) {
+    records_[head] = pending_;
+    // release so record is complete before consumer sees it
+    indices_->head.store(next, std::memory_order_release);
+  } else {
+    indices_->numberDropped.store(indices_->numberDropped.load(std::memory_order_relaxed) + 1,
+      std::memory_order_relaxed);
+  }
+  pending_.pivotRowLength = 0;
+  pending_.pivotColumnLength = 0;
+  pending_.flags = 0;
+}
+// Moves up to maximum records into array - returns number
+int ClpIterationTrace::drain(ClpIterationRecord *records, int maximum)
+{
+  int tail = indices_->tail.load(std::memory_order_relaxed);
+  int head = indices_->head.load(std::memory_order_acquire);
+  int n = 0;
+  while (tail != head && n < maximum) {
+    records[n++] = records_[tail];
+    tail++;
+    if (tail == size_)
+      tail = 0;
+  }
+  indices_->tail.store(tail, std::memory_order_release);
+  return n;
+}
+// Number of records dropped because buffer was full
+int ClpIterationTrace::numberDropped() const
+{
+  return indices_->numberDropped.load(std::memory_order_relaxed);
+}
+// Drains buffer as CSV lines - returns number
+int ClpIterationTrace::writeCsv(FILE *fp, bool header)
+{
+  if (header)
+    fprintf(fp, "iteration,in,out,rowLength,columnLength,pivots,flags,theta,alpha,objective\n");
+  ClpIterationRecord records[64];
+  int numberDone = 0;
+  int n;
+  while ((n = drain(records, 64)) > 0) {
+    for (int i = 0; i < n; i++) {
+      const ClpIterationRecord &record = records[i];
+      fprintf(fp, "%d,%d,%d,%d,%d,%d,%d,%.9g,%.9g,%.12g\n",
+        record.iteration, record.sequenceIn, record.sequenceOut,
+        record.pivotRowLength, record.pivotColumnLength,
+        record.pivots, record.flags,
+        record.theta, record.alpha, record.objective);
+    }
+    numberDone += n;
+  }
+  return numberDone;
+}
+// Drains buffer as raw records - returns number
+int ClpIterationTrace::writeBinary(FILE *fp)
+{
+  ClpIterationRecord records[64];
+  int numberDone = 0;
+  int n;
+  while ((n = drain(records, 64)) > 0) {
+    fwrite(records, sizeof(ClpIterationRecord), n, fp);
+    numberDone += n;
+  }
+  return numberDone;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
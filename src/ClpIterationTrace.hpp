@@ -0,0 +1,103 @@
+// Copyright (C) 2026, COIN-OR Foundation and others. All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef ClpIterationTrace_H
+#define ClpIterationTrace_H
+
+#include "ClpConfig.h"
+#include <cstdio>
+
+struct ClpIterationTraceIndices;
+
+/// One sampled simplex iteration (see ClpIterationTrace)
+typedef struct {
+  int iteration;
+  int sequenceIn;
+  int sequenceOut;
+  /// Elements in row of tableau (dual) - 0 if not known
+  int pivotRowLength;
+  /// Elements in updated incoming column
+  int pivotColumnLength;
+  /// Pivots since last factorization (1 means just refactorized)
+  int pivots;
+  /// 1 primal (else dual), 2 degenerate (theta zero), 4 bound flip
+  int flags;
+  double theta;
+  double alpha;
+  double objective;
+} ClpIterationRecord;
+/** Machine readable trace of simplex iterations
+
+Set on a model by ClpSimplex::setIterationTrace and written by the
+whileIterating loops of ClpSimplexDual and ClpSimplexPrimal every
+frequency iterations.  Records go into a fixed size ring buffer with a
+single producer (the solve) and a single consumer (whoever calls drain,
+writeCsv or writeBinary), so it can be emptied from another thread while
+the solve runs without any locking.  The ring indices are atomics (kept
+out of this header) so a record is complete before the consumer can see
+it.  If the buffer is full
+new records are dropped and counted rather than slowing the solve.
+*/
+
+class CLPLIB_EXPORT ClpIterationTrace {
+
+public:
+  /**@name Producer (solve) */
+  //@{
+  /// Whether this iteration should be recorded
+  inline bool wanted(int iteration) const
+  {
+    return (iteration % frequency_) == 0;
+  }
+  /// Partial record for current iteration - filled in as solve goes
+  inline ClpIterationRecord &pending()
+  {
+    return pending_;
+  }
+  /// Adds pending record (dropped if buffer full) and clears it
+  void add();
+  //@}
+
+  /**@name Consumer */
+  //@{
+  /// Moves up to maximum records into array - returns number
+  int drain(ClpIterationRecord *records, int maximum);
+  /// Drains buffer as CSV lines (header if wanted) - returns number
+  int writeCsv(FILE *fp, bool header = false);
+  /// Drains buffer as raw records - returns number
+  int writeBinary(FILE *fp);
+  /// Number of records dropped because buffer was full
+  int numberDropped() const;
+  //@}
+
+  /**@name Constructors, destructor */
+  //@{
+  /** Constructor - size is number of records buffered,
+         frequency is iterations between samples */
+  ClpIterationTrace(int size = 4096, int frequency = 1);
+  /** Destructor */
+  ~ClpIterationTrace();
+  //@}
+
+private:
+  // Not copyable
+  ClpIterationTrace(const ClpIterationTrace &);
+  ClpIterationTrace &operator=(const ClpIterationTrace &);
+  /**@name Data members */
+  //@{
+  /// Ring buffer
+  ClpIterationRecord *records_;
+  /// Size of ring buffer
+  int size_;
+  /// Iterations between samples
+  int frequency_;
+  /// Ring indices and count of records dropped
+  ClpIterationTraceIndices *indices_;
+  /// Record being built for current iteration
+  ClpIterationRecord pending_;
+  //@}
+};
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -2,6 +2,7 @@
 // Corporation and others.  All Rights Reserved.
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
+#include "CoinHelperFunctions.hpp"
 #include "ClpLsqr.hpp"
 #include "ClpPdco.hpp"
 
@@ -302,6 +303,153 @@ void ClpLsqr::do_lsqr(CoinDenseVector< double > &b,
   }
 }
 
+/* Preconditioned conjugate gradients on the normal equations (CGLS form)
+   for the same problem as do_lsqr.  With precon the operator is A*diag(Pr)
+   so, as for do_lsqr, the caller multiplies x by Pr afterwards.
+   Only two vectors of length nrows_ are needed and each iteration is one
+   product with A and one with A', so it is usable where LSQR is.
+*/
+void ClpLsqr::do_cgls(CoinDenseVector< double > &b,
+  double damp, double atol, double btol, double conlim, int itnlim,
+  bool show, Info info, CoinDenseVector< double > &x, int *istop,
+  int *itn, Outfo *outfo, bool precon, CoinDenseVector< double > &Pr)
+{
+  assert(model_);
+  int n = ncols_;
+  int m = nrows_;
+  *itn = 0;
+  *istop = 0;
+  double ctol = 0;
+  if (conlim > 0)
+    ctol = 1 / conlim;
+  double damp2 = damp * damp;
+  x.clear();
+  double *x_elts = x.getElements();
+  const double *pr_elts = Pr.getElements();
+  // r = b - A*x, s = A'*r - damp^2*x (preconditioned)
+  CoinDenseVector< double > r(b);
+  CoinDenseVector< double > s(n, 0.0);
+  CoinDenseVector< double > p(n, 0.0);
+  CoinDenseVector< double > pp(n, 0.0);
+  CoinDenseVector< double > q(m, 0.0);
+  double *r_elts = r.getElements();
+  double *s_elts = s.getElements();
+  double *p_elts = p.getElements();
+  double *pp_elts = pp.getElements();
+  double *q_elts = q.getElements();
+  matVecMult(2, s, r);
+  if (precon) {
+    for (int k = 0; k < n; k++)
+      s_elts[k] *= pr_elts[k];
+  }
+  CoinMemcpyN(s_elts, n, p_elts);
+  double bnorm = r.twoNorm();
+  double arnorm = s.twoNorm();
+  double gamma = arnorm * arnorm;
+  if (arnorm == 0) {
+    if (show)
+      printf("  The exact solution is x = 0\n\n");
+    return;
+  }
+  double anorm = 0;
+  // smallest |Abar*p|/|p| seen - with anorm gives cond(Abar) from below
+  double aminimum = COIN_DBL_MAX;
+  double acond = 0;
+  double rnorm = bnorm;
+  double xnorm = 0;
+  if (show)
+    printf("   Itn      x(1)      Function Compatible   LS      Norm A   Cond A\n");
+
+  while (*itn < itnlim) {
+    *itn += 1;
+    // q = A*P*p
+    if (precon) {
+      for (int k = 0; k < n; k++)
+        pp_elts[k] = p_elts[k] * pr_elts[k];
+    } else {
+      CoinMemcpyN(p_elts, n, pp_elts);
+    }
+    q.clear();
+    matVecMult(1, q, pp);
+    double pnorm = p.twoNorm();
+    double qnorm = q.twoNorm();
+    double qnorm2 = qnorm * qnorm + damp2 * pnorm * pnorm;
+    if (qnorm2 <= 0) {
+      *istop = 6;
+      break;
+    }
+    anorm = CoinMax(anorm, sqrt(qnorm2) / pnorm);
+    aminimum = CoinMin(aminimum, sqrt(qnorm2) / pnorm);
+    acond = anorm / aminimum;
+    double alpha = gamma / qnorm2;
+    for (int k = 0; k < n; k++)
+      x_elts[k] += alpha * p_elts[k];
+    for (int k = 0; k < m; k++)
+      r_elts[k] -= alpha * q_elts[k];
+    s.clear();
+    matVecMult(2, s, r);
+    if (precon) {
+      for (int k = 0; k < n; k++)
+        s_elts[k] *= pr_elts[k];
+    }
+    if (damp2) {
+      for (int k = 0; k < n; k++)
+        s_elts[k] -= damp2 * x_elts[k];
+    }
+    arnorm = s.twoNorm();
+    double gammaNew = arnorm * arnorm;
+    xnorm = x.twoNorm();
+    rnorm = r.twoNorm();
+    rnorm = sqrt(rnorm * rnorm + damp2 * xnorm * xnorm);
+
+    // Same tests as lsqr
+    double test1 = rnorm / bnorm;
+    double test2 = rnorm ? arnorm / (anorm * rnorm) : 0.0;
+    double test3 = 1 / acond;
+    double rtol = btol + atol * anorm * xnorm / bnorm;
+    if (*itn >= itnlim)
+      *istop = 7;
+    if (test3 <= ctol)
+      *istop = 3;
+    if (test2 <= atol)
+      *istop = 2;
+    if (test1 <= rtol)
+      *istop = 1;
+    if (show && (*itn <= 10 || *itn % 10 == 0 || *istop))
+      printf("%6d %12.5e %10.3e  %8.1e  %8.1e  %8.1e %8.1e\n", *itn, x[0], rnorm,
+        test1, test2, anorm, acond);
+
+    // pdco specific test as in do_lsqr
+    if (*istop > 0) {
+      double r3ratio = arnorm / info.r3norm;
+      double atolold = atol;
+      double atolnew = atol;
+      if (atol > info.atolmin) {
+        if (r3ratio <= 0.1) { // dy seems good
+          // Relax
+        } else if (r3ratio <= 0.5) { // Accept dy but make next one more accurate.
+          atolnew = atolnew * 0.1;
+        } else if (*istop != 7) { // Recompute dy more accurately
+          atol = atol * 0.1;
+          atolnew = atol;
+          *istop = 0;
+        }
+        outfo->atolold = atolold;
+        outfo->atolnew = atolnew;
+        outfo->r3ratio = r3ratio;
+      }
+      if (*istop > 0)
+        break;
+    }
+    double beta = gammaNew / gamma;
+    gamma = gammaNew;
+    for (int k = 0; k < n; k++)
+      p_elts[k] = s_elts[k] + beta * p_elts[k];
+  }
+  if (show)
+    printf("\n CGLS finished istop =%8d     itn    =%8d\n", *istop, *itn);
+}
+
 void ClpLsqr::matVecMult(int mode, CoinDenseVector< double > *x, CoinDenseVector< double > *y)
 {
   int n = model_->numberColumns();
@@ -115,6 +115,14 @@ public:
     double damp, double atol, double btol, double conlim, int itnlim,
     bool show, Info info, CoinDenseVector< double > &x, int *istop,
     int *itn, Outfo *outfo, bool precon, CoinDenseVector< double > &Pr);
+  /** Call preconditioned conjugate gradients on normal equations (CGLS)
+      instead of Lsqr - same arguments and same pdco specific test.
+      cond(Abar) for conlim is estimated from largest and smallest
+      |Abar*p|/|p| over search directions p */
+  void do_cgls(CoinDenseVector< double > &b,
+    double damp, double atol, double btol, double conlim, int itnlim,
+    bool show, Info info, CoinDenseVector< double > &x, int *istop,
+    int *itn, Outfo *outfo, bool precon, CoinDenseVector< double > &Pr);
   /// Matrix-vector multiply - implemented by user
   void matVecMult(int, CoinDenseVector< double > *, CoinDenseVector< double > *);
 
@@ -64,6 +64,7 @@ static Clp_message clp_us_english[] = {
   { CLP_IMPORT_ERRORS, 3001, 1, " There were %d errors when importing model from %s" },
   { CLP_EMPTY_PROBLEM, 3002, 1, "Empty problem - %d rows, %d columns and %d elements" },
   { CLP_CRASH, 28, 1, "Crash put %d variables in basis, %d dual infeasibilities" },
+  { CLP_CRASH_TRIANGULAR, 66, 1, "Triangular crash put %d of %d candidate structurals in basis" },
   { CLP_END_VALUES_PASS, 29, 1, "End of values pass after %d iterations" },
   { CLP_QUADRATIC_BOTH, 108, 32, "%s %d (%g) and %d (%g) both basic" },
   { CLP_QUADRATIC_PRIMAL_DETAILS, 109, 32, "coeff %g, %g, %g - dj %g - deriv zero at %g, sj at %g" },
@@ -62,6 +62,7 @@ enum CLP_Message {
   CLP_IMPORT_ERRORS,
   CLP_EMPTY_PROBLEM,
   CLP_CRASH,
+  CLP_CRASH_TRIANGULAR,
   CLP_END_VALUES_PASS,
   CLP_QUADRATIC_BOTH,
   CLP_QUADRATIC_PRIMAL_DETAILS,
@@ -247,6 +247,8 @@ void ClpModel::setDualTolerance(double value)
 }
 void ClpModel::setOptimizationDirection(double value)
 {
+  if (optimizationDirection_ != value)
+    whatsChanged_ &= ~64; // objective needs redoing
   optimizationDirection_ = value;
 }
 void ClpModel::gutsOfLoadModel(int numberRows, int numberColumns,
@@ -271,7 +273,6 @@ void ClpModel::gutsOfLoadModel(int numberRows, int numberColumns,
 
   CoinZeroN(dual_, numberRows_);
   CoinZeroN(reducedCost_, numberColumns_);
-  int iRow, iColumn;
 
   rowLower_ = ClpCopyOfArray(rowlb, numberRows_, -COIN_DBL_MAX);
   rowUpper_ = ClpCopyOfArray(rowub, numberRows_, COIN_DBL_MAX);
@@ -281,6 +282,12 @@ void ClpModel::gutsOfLoadModel(int numberRows, int numberColumns,
   rowObjective_ = ClpCopyOfArray(rowObjective, numberRows_);
   columnLower_ = ClpCopyOfArray(collb, numberColumns_, 0.0);
   columnUpper_ = ClpCopyOfArray(colub, numberColumns_, COIN_DBL_MAX);
+  gutsOfCleanBounds();
+}
+// Sets default solution and cleans infinite bounds
+void ClpModel::gutsOfCleanBounds()
+{
+  int iRow, iColumn;
   // set default solution and clean bounds
   for (iRow = 0; iRow < numberRows_; iRow++) {
     if (rowLower_[iRow] > 0.0) {
@@ -399,6 +406,56 @@ void ClpModel::loadProblem(
     value, index, start, length);
   matrix_ = new ClpPackedMatrix(matrix);
 }
+/* Takes over ownership of arrays - no copies of matrix or bounds are made.
+   Arrays must have been allocated by new[] and pointers are NULL on return */
+int ClpModel::assignProblem(int numcols, int numrows,
+  CoinBigIndex *&start, int *&index, double *&value,
+  double *&collb, double *&colub, double *&obj,
+  double *&rowlb, double *&rowub, int checkType)
+{
+  gutsOfLoadModel(numrows, numcols, NULL, NULL, NULL, NULL, NULL, NULL);
+  // swap in bounds (defaults already there if NULL)
+  if (collb) {
+    delete[] columnLower_;
+    columnLower_ = collb;
+    collb = NULL;
+  }
+  if (colub) {
+    delete[] columnUpper_;
+    columnUpper_ = colub;
+    colub = NULL;
+  }
+  if (rowlb) {
+    delete[] rowLower_;
+    rowLower_ = rowlb;
+    rowlb = NULL;
+  }
+  if (rowub) {
+    delete[] rowUpper_;
+    rowUpper_ = rowub;
+    rowub = NULL;
+  }
+  gutsOfCleanBounds();
+  if (obj) {
+    // objective keeps its own copy
+    delete objective_;
+    objective_ = new ClpLinearObjective(obj, numcols);
+    delete[] obj;
+    obj = NULL;
+  }
+  // matrix just takes arrays (lengths will be computed)
+  int *length = NULL;
+  CoinPackedMatrix *matrix = new CoinPackedMatrix();
+  matrix->assignMatrix(true, numrows, numcols, start[numcols],
+    value, index, start, length);
+  delete matrix_;
+  ClpPackedMatrix *clpMatrix = new ClpPackedMatrix(matrix);
+  matrix_ = clpMatrix;
+  int numberDuplicates = 0;
+  if (checkType)
+    numberDuplicates = clpMatrix->cleanElements(checkType);
+  return numberDuplicates;
+}
 #ifndef SLIM_NOIO
 // This loads a model from a coinModel object - returns number of errors
 int ClpModel::loadProblem(CoinModel &modelObject, bool tryPlusMinusOne)
@@ -2667,7 +2724,7 @@ void ClpModel::chgRowLower(const double *rowLower)
 {
   int numberRows = numberRows_;
   int iRow;
-  whatsChanged_ = 0; // Use ClpSimplex stuff to keep
+  whatsChanged_ &= ~16; // only row lower needs redoing
   if (rowLower) {
     for (iRow = 0; iRow < numberRows; iRow++) {
       double value = rowLower[iRow];
@@ -2684,7 +2741,7 @@ void ClpModel::chgRowLower(const double *rowLower)
 // chgRowUpper
 void ClpModel::chgRowUpper(const double *rowUpper)
 {
-  whatsChanged_ = 0; // Use ClpSimplex stuff to keep
+  whatsChanged_ &= ~32; // only row upper needs redoing
   int numberRows = numberRows_;
   int iRow;
   if (rowUpper) {
@@ -2704,7 +2761,7 @@ void ClpModel::chgRowUpper(const double *rowUpper)
 // chgColumnLower
 void ClpModel::chgColumnLower(const double *columnLower)
 {
-  whatsChanged_ = 0; // Use ClpSimplex stuff to keep
+  whatsChanged_ &= ~128; // only column lower needs redoing
   int numberColumns = numberColumns_;
   int iColumn;
   if (columnLower) {
@@ -2723,7 +2780,7 @@ void ClpModel::chgColumnLower(const double *columnLower)
 // chgColumnUpper
 void ClpModel::chgColumnUpper(const double *columnUpper)
 {
-  whatsChanged_ = 0; // Use ClpSimplex stuff to keep
+  whatsChanged_ &= ~256; // only column upper needs redoing
   int numberColumns = numberColumns_;
   int iColumn;
   if (columnUpper) {
@@ -2743,7 +2800,7 @@ void ClpModel::chgColumnUpper(const double *columnUpper)
 // chgObjCoefficients
 void ClpModel::chgObjCoefficients(const double *objIn)
 {
-  whatsChanged_ = 0; // Use ClpSimplex stuff to keep
+  whatsChanged_ &= ~64; // only objective needs redoing
   double *obj = objective();
   int numberColumns = numberColumns_;
   int iColumn;
@@ -4568,3 +4625,265 @@ ClpModel::cleanScalingEtc()
   rowScale_ = NULL;
   columnScale_ = NULL;
 }
+//#############################################################################
+// Cache of scale factors
+//#############################################################################
+ClpScaleCache::ClpScaleCache(int maximumEntries)
+  : entry_(NULL)
+  , numberEntries_(0)
+  , maximumEntries_(CoinMax(maximumEntries, 1))
+  , nextReplace_(0)
+  , numberHits_(0)
+{
+  entry_ = new ClpScaleCacheEntry[maximumEntries_];
+}
+ClpScaleCache::ClpScaleCache(const ClpScaleCache &rhs)
+  : entry_(NULL)
+  , numberEntries_(0)
+  , maximumEntries_(1)
+  , nextReplace_(0)
+  , numberHits_(0)
+{
+  gutsOfCopy(rhs);
+}
+ClpScaleCache &
+ClpScaleCache::operator=(const ClpScaleCache &rhs)
+{
+  if (this != &rhs) {
+    clear();
+    delete[] entry_;
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+ClpScaleCache::~ClpScaleCache()
+{
+  clear();
+  delete[] entry_;
+}
+void ClpScaleCache::gutsOfCopy(const ClpScaleCache &rhs)
+{
+  numberEntries_ = rhs.numberEntries_;
+  maximumEntries_ = rhs.maximumEntries_;
+  nextReplace_ = rhs.nextReplace_;
+  numberHits_ = rhs.numberHits_;
+  entry_ = new ClpScaleCacheEntry[maximumEntries_];
+  for (int i = 0; i < numberEntries_; i++) {
+    entry_[i] = rhs.entry_[i];
+    entry_[i].scale = CoinCopyOfArray(rhs.entry_[i].scale,
+      rhs.entry_[i].numberRows + rhs.entry_[i].numberColumns);
+  }
+}
+void ClpScaleCache::clear()
+{
+  for (int i = 0; i < numberEntries_; i++)
+    delete[] entry_[i].scale;
+  numberEntries_ = 0;
+  nextReplace_ = 0;
+}
+// Hash of sparsity pattern of matrix of model (FNV-1a)
+unsigned int
+ClpScaleCache::patternHash(const ClpModel *model)
+{
+  const unsigned int prime = 16777619u;
+  unsigned int hash = 2166136261u;
+  hash = (hash ^ static_cast< unsigned int >(model->numberRows())) * prime;
+  hash = (hash ^ static_cast< unsigned int >(model->numberColumns())) * prime;
+  const CoinPackedMatrix *matrix = model->matrix();
+  if (matrix) {
+    const int *row = matrix->getIndices();
+    const CoinBigIndex *columnStart = matrix->getVectorStarts();
+    const int *columnLength = matrix->getVectorLengths();
+    int numberColumns = matrix->getNumCols();
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      hash = (hash ^ static_cast< unsigned int >(columnLength[iColumn])) * prime;
+      for (CoinBigIndex j = columnStart[iColumn];
+           j < columnStart[iColumn] + columnLength[iColumn]; j++)
+        hash = (hash ^ static_cast< unsigned int >(row[j])) * prime;
+    }
+  }
+  return hash;
+}
+// Returns entry or -1
+int ClpScaleCache::find(unsigned int hash, int numberRows, int numberColumns,
+  CoinBigIndex numberElements) const
+{
+  for (int i = 0; i < numberEntries_; i++) {
+    if (entry_[i].hash == hash && entry_[i].numberRows == numberRows
+      && entry_[i].numberColumns == numberColumns
+      && entry_[i].numberElements == numberElements)
+      return i;
+  }
+  return -1;
+}
+// Returns entry to use for new data
+int ClpScaleCache::newEntry(unsigned int hash, int numberRows, int numberColumns,
+  CoinBigIndex numberElements)
+{
+  int i = find(hash, numberRows, numberColumns, numberElements);
+  if (i < 0) {
+    if (numberEntries_ < maximumEntries_) {
+      i = numberEntries_++;
+    } else {
+      // replace oldest
+      i = nextReplace_;
+      nextReplace_ = (nextReplace_ + 1) % maximumEntries_;
+      delete[] entry_[i].scale;
+    }
+  } else {
+    delete[] entry_[i].scale;
+  }
+  entry_[i].hash = hash;
+  entry_[i].numberRows = numberRows;
+  entry_[i].numberColumns = numberColumns;
+  entry_[i].numberElements = numberElements;
+  entry_[i].scale = new double[numberRows + numberColumns];
+  return i;
+}
+// Saves current scale factors of model
+bool ClpScaleCache::save(const ClpModel *model)
+{
+  const double *rowScale = model->rowScale();
+  const double *columnScale = model->columnScale();
+  if (!rowScale || !columnScale || !model->matrix())
+    return false;
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+  int i = newEntry(patternHash(model), numberRows, numberColumns,
+    model->matrix()->getNumElements());
+  CoinMemcpyN(rowScale, numberRows, entry_[i].scale);
+  CoinMemcpyN(columnScale, numberColumns, entry_[i].scale + numberRows);
+  return true;
+}
+// If pattern found gives scale factors to model after one refinement pass
+bool ClpScaleCache::apply(ClpModel *model)
+{
+  CoinPackedMatrix *matrix = model->matrix();
+  if (model->rowScale() || (model->specialOptions() & 65536) != 0 || !matrix)
+    return false;
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+  int iEntry = find(patternHash(model), numberRows, numberColumns,
+    matrix->getNumElements());
+  if (iEntry < 0)
+    return false;
+  numberHits_++;
+  double *rowScale = new double[2 * numberRows];
+  double *columnScale = new double[2 * numberColumns];
+  CoinMemcpyN(entry_[iEntry].scale, numberRows, rowScale);
+  CoinMemcpyN(entry_[iEntry].scale + numberRows, numberColumns, columnScale);
+  // one geometric pass on rows then on columns
+  const int *row = matrix->getIndices();
+  const CoinBigIndex *columnStart = matrix->getVectorStarts();
+  const int *columnLength = matrix->getVectorLengths();
+  const double *element = matrix->getElements();
+  // use inverse parts as work arrays
+  double *smallest = rowScale + numberRows;
+  double *largest = new double[numberRows];
+  CoinFillN(smallest, numberRows, 1.0e50);
+  CoinZeroN(largest, numberRows);
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    double scale = columnScale[iColumn];
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      double value = fabs(element[j]);
+      if (value > 1.0e-20) {
+        int iRow = row[j];
+        value *= scale * rowScale[iRow];
+        smallest[iRow] = CoinMin(smallest[iRow], value);
+        largest[iRow] = CoinMax(largest[iRow], value);
+      }
+    }
+  }
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    if (largest[iRow])
+      rowScale[iRow] /= sqrt(smallest[iRow] * largest[iRow]);
+  }
+  delete[] largest;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    double smallestValue = 1.0e50;
+    double largestValue = 0.0;
+    double scale = columnScale[iColumn];
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      double value = fabs(element[j]);
+      if (value > 1.0e-20) {
+        value *= scale * rowScale[row[j]];
+        smallestValue = CoinMin(smallestValue, value);
+        largestValue = CoinMax(largestValue, value);
+      }
+    }
+    if (largestValue)
+      columnScale[iColumn] /= sqrt(smallestValue * largestValue);
+  }
+  for (int iRow = 0; iRow < numberRows; iRow++)
+    rowScale[iRow + numberRows] = 1.0 / rowScale[iRow];
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+    columnScale[iColumn + numberColumns] = 1.0 / columnScale[iColumn];
+  model->setRowScale(rowScale);
+  model->setColumnScale(columnScale);
+  return true;
+}
+// Writes cache to file - returns non-zero on error
+int ClpScaleCache::write(const char *fileName) const
+{
+  FILE *fp = fopen(fileName, "wb");
+  if (!fp)
+    return 1;
+  int header[3];
+  header[0] = 1; // version
+  header[1] = static_cast< int >(sizeof(CoinBigIndex));
+  header[2] = numberEntries_;
+  size_t nWrite = fwrite(header, sizeof(int), 3, fp);
+  int returnCode = (nWrite != 3) ? 2 : 0;
+  for (int i = 0; i < numberEntries_ && !returnCode; i++) {
+    const ClpScaleCacheEntry &thisEntry = entry_[i];
+    int sizes[2] = { thisEntry.numberRows, thisEntry.numberColumns };
+    int n = thisEntry.numberRows + thisEntry.numberColumns;
+    if (fwrite(&thisEntry.hash, sizeof(unsigned int), 1, fp) != 1
+      || fwrite(sizes, sizeof(int), 2, fp) != 2
+      || fwrite(&thisEntry.numberElements, sizeof(CoinBigIndex), 1, fp) != 1
+      || fwrite(thisEntry.scale, sizeof(double), n, fp) != static_cast< size_t >(n))
+      returnCode = 2;
+  }
+  fclose(fp);
+  return returnCode;
+}
+// Reads cache from file (adding to entries) - returns non-zero on error
+int ClpScaleCache::read(const char *fileName)
+{
+  FILE *fp = fopen(fileName, "rb");
+  if (!fp)
+    return 1;
+  int header[3];
+  if (fread(header, sizeof(int), 3, fp) != 3 || header[0] != 1
+    || header[1] != static_cast< int >(sizeof(CoinBigIndex)) || header[2] < 0) {
+    fclose(fp);
+    return 2;
+  }
+  int returnCode = 0;
+  for (int i = 0; i < header[2]; i++) {
+    unsigned int hash;
+    int sizes[2];
+    CoinBigIndex numberElements;
+    if (fread(&hash, sizeof(unsigned int), 1, fp) != 1
+      || fread(sizes, sizeof(int), 2, fp) != 2
+      || fread(&numberElements, sizeof(CoinBigIndex), 1, fp) != 1
+      || sizes[0] < 0 || sizes[1] < 0) {
+      returnCode = 2;
+      break;
+    }
+    int n = sizes[0] + sizes[1];
+    double *scale = new double[n];
+    if (fread(scale, sizeof(double), n, fp) != static_cast< size_t >(n)) {
+      delete[] scale;
+      returnCode = 2;
+      break;
+    }
+    int iEntry = newEntry(hash, sizes[0], sizes[1], numberElements);
+    delete[] entry_[iEntry].scale;
+    entry_[iEntry].scale = scale;
+  }
+  fclose(fp);
+  return returnCode;
+}
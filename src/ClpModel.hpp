@@ -111,6 +111,19 @@ public:
     const double *obj,
     const double *rowlb, const double *rowub,
     const double *rowObjective = NULL);
+  /** Bulk load which takes ownership of arrays rather than copying.
+         Matrix is column ordered (start has numcols+1 entries).
+         All arrays must have been allocated with new[] and
+         pointers are NULL on return.  NULL bound or objective arrays
+         give same defaults as loadProblem.
+         checkType 1 - drop explicit zero elements,
+         2 - merge duplicate elements (both in parallel if threads).
+         Returns number of duplicates merged.
+     */
+  int assignProblem(int numcols, int numrows,
+    CoinBigIndex *&start, int *&index, double *&value,
+    double *&collb, double *&colub, double *&obj,
+    double *&rowlb, double *&rowub, int checkType = 0);
   /** Load up quadratic objective.  This is stored as a CoinPackedMatrix */
   void loadQuadraticObjective(const int numberColumns,
     const CoinBigIndex *start,
@@ -1209,6 +1222,8 @@ protected:
     const double *obj,
     const double *rowlb, const double *rowub,
     const double *rowObjective = NULL);
+  /// Sets default solution and cleans infinite bounds
+  void gutsOfCleanBounds();
   /// Does much of scaling
   void gutsOfScaling();
   /// Objective value - always minimize
@@ -1434,6 +1449,91 @@ public:
   unsigned int specialOptions_;
   //@}
 };
+/** Cache of row and column scale factors for models which share a
+    sparsity pattern but have slightly different coefficients.
+
+    Entries are keyed on a hash of dimensions, column lengths and row
+    indices.  If an entry is found its scales are given to the model with
+    one geometric refinement pass, which is much cheaper than scaling from
+    scratch.  A false match on the hash only costs speed as any positive
+    scale factors are valid.  The cache may be written to and read from a
+    file so it persists between runs.
+ */
+class CLPLIB_EXPORT ClpScaleCache {
+
+public:
+  /**@name Constructors and destructor
+      */
+  //@{
+  /// Default constructor
+  ClpScaleCache(int maximumEntries = 100);
+  /// Copy constructor.
+  ClpScaleCache(const ClpScaleCache &);
+  /// Assignment operator. This copies the data
+  ClpScaleCache &operator=(const ClpScaleCache &rhs);
+  /// Destructor
+  ~ClpScaleCache();
+  //@}
+
+  /**@name Use */
+  //@{
+  /// Hash of sparsity pattern of matrix of model
+  static unsigned int patternHash(const ClpModel *model);
+  /** Saves current scale factors of model (replacing any with same
+      pattern).  Returns false if model not scaled */
+  bool save(const ClpModel *model);
+  /** If pattern found gives scale factors to model after one
+      refinement pass.  Returns true if found */
+  bool apply(ClpModel *model);
+  /// Writes cache to file - returns non-zero on error
+  int write(const char *fileName) const;
+  /// Reads cache from file (adding to entries) - returns non-zero on error
+  int read(const char *fileName);
+  /// Deletes all entries
+  void clear();
+  /// Number of entries
+  inline int numberEntries() const
+  {
+    return numberEntries_;
+  }
+  /// Number of times apply found an entry
+  inline int numberHits() const
+  {
+    return numberHits_;
+  }
+  //@}
+
+private:
+  /// Returns entry or -1
+  int find(unsigned int hash, int numberRows, int numberColumns,
+    CoinBigIndex numberElements) const;
+  /// Returns entry to use for new data
+  int newEntry(unsigned int hash, int numberRows, int numberColumns,
+    CoinBigIndex numberElements);
+  /// Copies from another cache
+  void gutsOfCopy(const ClpScaleCache &rhs);
+
+  typedef struct {
+    double *scale; // rows then columns
+    CoinBigIndex numberElements;
+    int numberRows;
+    int numberColumns;
+    unsigned int hash;
+  } ClpScaleCacheEntry;
+  /**@name data */
+  //@{
+  /// Entries
+  ClpScaleCacheEntry *entry_;
+  /// Number of entries
+  int numberEntries_;
+  /// Maximum number of entries
+  int maximumEntries_;
+  /// Next entry to replace when full
+  int nextReplace_;
+  /// Number of times apply found an entry
+  int numberHits_;
+  //@}
+};
 
 // Semi experimental options 
 #ifdef CLP_EXPERIMENT_JJF
@@ -4129,6 +4129,216 @@ static void doSqrts(double *array, int n)
 #endif
 //static int scale_stats[5]={0,0,0,0,0};
 // Creates scales for column copy (rowCopy in model may be modified)
+// Below this many elements scaling passes are done serially
+#ifndef CLP_SCALE_PARALLEL
+#define CLP_SCALE_PARALLEL 100000
+#endif
+/* One scaling pass over a block of rows or columns.
+   numberAdded is type -
+   0 maximum in each row (row copy)
+   1 geometric mean on row scales (row copy)
+   2 geometric mean on column scales
+   3 see what smallest will be if largest is 1.0 (columns)
+   4,5 scale elements of row copy or gapless column copy in place
+   For 0-3 cost is other scale, spare is scale being set and status is
+   usefulColumn.  For 4,5 work is elements, cost is scale of major
+   dimension and lower of minor.  upperTheta and bestPossible are
+   largest and smallest (only min/max so same for any number of threads) */
+static void
+scalePassBit(clpTempInfo &info)
+{
+  const double *COIN_RESTRICT element = info.element;
+  const CoinBigIndex *COIN_RESTRICT start = info.start;
+  const int *COIN_RESTRICT length = info.which;
+  const int *COIN_RESTRICT index = info.row;
+  const unsigned char *COIN_RESTRICT useful = info.status;
+  const double *COIN_RESTRICT otherScale = info.cost;
+  double *COIN_RESTRICT scale = info.spare;
+  double overallLargest = info.upperTheta;
+  double overallSmallest = info.bestPossible;
+  bool extraDetails = info.numberInfeasibilities != 0;
+  int first = info.startColumn;
+  int last = first + info.numberToDo;
+  switch (info.numberAdded) {
+  case 0:
+    for (int iRow = first; iRow < last; iRow++) {
+      double largest = 1.0e-10;
+      for (CoinBigIndex j = start[iRow]; j < start[iRow + 1]; j++) {
+        int iColumn = index[j];
+        if (useful[iColumn]) {
+          double value = fabs(element[j]);
+          largest = CoinMax(largest, value);
+          assert(largest < 1.0e40);
+        }
+      }
+      scale[iRow] = 1.0 / largest;
+#ifdef COIN_DEVELOP
+      if (extraDetails) {
+        overallLargest = CoinMax(overallLargest, largest);
+        overallSmallest = CoinMin(overallSmallest, largest);
+      }
+#endif
+    }
+    break;
+  case 1:
+    for (int iRow = first; iRow < last; iRow++) {
+      double largest = 1.0e-50;
+      double smallest = 1.0e50;
+      for (CoinBigIndex j = start[iRow]; j < start[iRow + 1]; j++) {
+        int iColumn = index[j];
+        if (useful[iColumn]) {
+          double value = fabs(element[j]);
+          value *= otherScale[iColumn];
+          largest = CoinMax(largest, value);
+          smallest = CoinMin(smallest, value);
+        }
+      }
+#ifdef SQRT_ARRAY
+      scale[iRow] = smallest * largest;
+#else
+      scale[iRow] = 1.0 / sqrt(smallest * largest);
+#endif
+      if (extraDetails) {
+        overallLargest = CoinMax(largest * scale[iRow], overallLargest);
+        overallSmallest = CoinMin(smallest * scale[iRow], overallSmallest);
+      }
+    }
+    break;
+  case 2:
+    for (int iColumn = first; iColumn < last; iColumn++) {
+      if (useful[iColumn]) {
+        double largest = 1.0e-50;
+        double smallest = 1.0e50;
+        for (CoinBigIndex j = start[iColumn];
+             j < start[iColumn] + length[iColumn]; j++) {
+          int iRow = index[j];
+          double value = fabs(element[j]);
+          value *= otherScale[iRow];
+          largest = CoinMax(largest, value);
+          smallest = CoinMin(smallest, value);
+        }
+#ifdef USE_OBJECTIVE
+        const double *COIN_RESTRICT objective = info.solution;
+        if (fabs(objective[iColumn]) > 1.0e-20) {
+          double value = fabs(objective[iColumn]) * info.theta;
+          largest = CoinMax(largest, value);
+          smallest = CoinMin(smallest, value);
+        }
+#endif
+#ifdef SQRT_ARRAY
+        scale[iColumn] = smallest * largest;
+#else
+        scale[iColumn] = 1.0 / sqrt(smallest * largest);
+#endif
+      }
+    }
+    break;
+  case 3:
+    for (int iColumn = first; iColumn < last; iColumn++) {
+      if (useful[iColumn]) {
+        double largest = 1.0e-20;
+        double smallest = 1.0e50;
+        for (CoinBigIndex j = start[iColumn];
+             j < start[iColumn] + length[iColumn]; j++) {
+          int iRow = index[j];
+          double value = fabs(element[j] * otherScale[iRow]);
+          largest = CoinMax(largest, value);
+          smallest = CoinMin(smallest, value);
+        }
+        // exact minimum so same for any number of threads
+        double ratio = smallest / largest;
+        if (overallSmallest > ratio)
+          overallSmallest = ratio;
+      }
+    }
+    break;
+  case 4:
+  case 5: {
+    double *COIN_RESTRICT elementX = info.work;
+    const double *COIN_RESTRICT minorScale = info.lower;
+    for (int i = first; i < last; i++) {
+      double majorScale = otherScale[i];
+      for (CoinBigIndex j = start[i]; j < start[i + 1]; j++) {
+        int iMinor = index[j];
+        elementX[j] *= majorScale * minorScale[iMinor];
+      }
+    }
+  } break;
+  }
+  info.upperTheta = overallLargest;
+  info.bestPossible = overallSmallest;
+}
+/* Does scaling pass over number rows or columns using up to
+   numberThreads and combines largest and smallest */
+static void
+scalePass(clpTempInfo &info, int number, int numberThreads)
+{
+#if ABOCA_LITE
+  if (numberThreads > 1) {
+    clpTempInfo infoX[ABOCA_LITE];
+    int chunk = (number + numberThreads - 1) / numberThreads;
+    int n = 0;
+    for (int i = 0; i < numberThreads; i++) {
+      infoX[i] = info;
+      infoX[i].startColumn = n;
+      infoX[i].numberToDo = CoinMax(CoinMin(chunk, number - n), 0);
+      n += chunk;
+    }
+    for (int i = 0; i < numberThreads; i++)
+      cilk_spawn scalePassBit(infoX[i]);
+    cilk_sync;
+    for (int i = 0; i < numberThreads; i++) {
+      info.upperTheta = CoinMax(info.upperTheta, infoX[i].upperTheta);
+      info.bestPossible = CoinMin(info.bestPossible, infoX[i].bestPossible);
+    }
+    return;
+  }
+#endif
+  info.startColumn = 0;
+  info.numberToDo = number;
+  scalePassBit(info);
+}
+/* Scales row copy (numberRows in info[0]) and column copy
+   (numberColumns in info[1]) in same parallel sweep */
+static void
+scaleCopies(clpTempInfo *info, int numberRows, int numberColumns,
+  int numberThreads)
+{
+#if ABOCA_LITE
+  if (numberThreads > 1) {
+    clpTempInfo infoX[2 * ABOCA_LITE];
+    int number[2] = { numberRows, numberColumns };
+    for (int k = 0; k < 2; k++) {
+      int chunk = (number[k] + numberThreads - 1) / numberThreads;
+      int n = 0;
+      for (int i = 0; i < numberThreads; i++) {
+        clpTempInfo &thisInfo = infoX[k * numberThreads + i];
+        thisInfo = info[k];
+        thisInfo.startColumn = n;
+        thisInfo.numberToDo = CoinMax(CoinMin(chunk, number[k] - n), 0);
+        n += chunk;
+      }
+    }
+    for (int i = 0; i < 2 * numberThreads; i++)
+      cilk_spawn scalePassBit(infoX[i]);
+    cilk_sync;
+    return;
+  }
+#endif
+  scalePass(info[0], numberRows, 1);
+  scalePass(info[1], numberColumns, 1);
+}
+// Number of threads to use for scaling
+static int
+scaleThreads(CoinBigIndex numberElements)
+{
+#if ABOCA_LITE
+  int numberThreads = abcState();
+  if (numberThreads > 1 && numberElements > CLP_SCALE_PARALLEL)
+    return numberThreads;
+#endif
+  return 1;
+}
 int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
 {
   //const ClpSimplex * baseModel=NULL;
@@ -4308,6 +4518,25 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
     const int *COIN_RESTRICT column = rowCopy->getIndices();
     const CoinBigIndex *COIN_RESTRICT rowStart = rowCopy->getVectorStarts();
     const double *COIN_RESTRICT element = rowCopy->getElements();
+    int numberThreads = scaleThreads(matrix_->getNumElements());
+    // for passes by row and by column
+    clpTempInfo rowInfo;
+    memset(&rowInfo, 0, sizeof(clpTempInfo));
+    rowInfo.element = element;
+    rowInfo.start = rowStart;
+    rowInfo.row = column;
+    rowInfo.status = reinterpret_cast< const unsigned char * >(usefulColumn);
+    rowInfo.cost = columnScale;
+    rowInfo.spare = rowScale;
+    clpTempInfo columnInfo;
+    memset(&columnInfo, 0, sizeof(clpTempInfo));
+    columnInfo.element = elementByColumn;
+    columnInfo.start = columnStart;
+    columnInfo.which = columnLength;
+    columnInfo.row = row;
+    columnInfo.status = reinterpret_cast< const unsigned char * >(usefulColumn);
+    columnInfo.cost = rowScale;
+    columnInfo.spare = columnScale;
     // need to scale
     if (largest > 1.0e13 * smallest) {
       // safer to have smaller zero tolerance
@@ -4349,25 +4578,13 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
       ClpFillN(columnScale, numberColumns, 1.0);
       if (scalingMethod == 1 || scalingMethod == 3) {
         // Maximum in each row
-        for (iRow = 0; iRow < numberRows; iRow++) {
-          CoinBigIndex j;
-          largest = 1.0e-10;
-          for (j = rowStart[iRow]; j < rowStart[iRow + 1]; j++) {
-            int iColumn = column[j];
-            if (usefulColumn[iColumn]) {
-              double value = fabs(element[j]);
-              largest = CoinMax(largest, value);
-              assert(largest < 1.0e40);
-            }
-          }
-          rowScale[iRow] = 1.0 / largest;
-#ifdef COIN_DEVELOP
-          if (extraDetails) {
-            overallLargest = CoinMax(overallLargest, largest);
-            overallSmallest = CoinMin(overallSmallest, largest);
-          }
-#endif
-        }
+        rowInfo.numberAdded = 0;
+        rowInfo.numberInfeasibilities = extraDetails ? 1 : 0;
+        rowInfo.upperTheta = overallLargest;
+        rowInfo.bestPossible = overallSmallest;
+        scalePass(rowInfo, numberRows, numberThreads);
+        overallLargest = rowInfo.upperTheta;
+        overallSmallest = rowInfo.bestPossible;
       } else {
 #ifdef USE_OBJECTIVE
         // This will be used to help get scale factors
@@ -4380,31 +4597,13 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
           overallSmallest = 1.0e50;
           numberPass--;
           // Geometric mean on row scales
-          for (iRow = 0; iRow < numberRows; iRow++) {
-            CoinBigIndex j;
-            largest = 1.0e-50;
-            smallest = 1.0e50;
-            for (j = rowStart[iRow]; j < rowStart[iRow + 1]; j++) {
-              int iColumn = column[j];
-              if (usefulColumn[iColumn]) {
-                double value = fabs(element[j]);
-                value *= columnScale[iColumn];
-                largest = CoinMax(largest, value);
-                smallest = CoinMin(smallest, value);
-              }
-            }
-
-#ifdef SQRT_ARRAY
-            rowScale[iRow] = smallest * largest;
-#else
-            rowScale[iRow] = 1.0 / sqrt(smallest * largest);
-#endif
-            //rowScale[iRow]=CoinMax(1.0e-10,CoinMin(1.0e10,rowScale[iRow]));
-            if (extraDetails) {
-              overallLargest = CoinMax(largest * rowScale[iRow], overallLargest);
-              overallSmallest = CoinMin(smallest * rowScale[iRow], overallSmallest);
-            }
-          }
+          rowInfo.numberAdded = 1;
+          rowInfo.numberInfeasibilities = extraDetails ? 1 : 0;
+          rowInfo.upperTheta = overallLargest;
+          rowInfo.bestPossible = overallSmallest;
+          scalePass(rowInfo, numberRows, numberThreads);
+          overallLargest = rowInfo.upperTheta;
+          overallSmallest = rowInfo.bestPossible;
           if (model->scalingFlag() == 5)
             break; // just scale rows
 #ifdef SQRT_ARRAY
@@ -4431,34 +4630,12 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
           if (numberPass == 1)
             break;
           // Geometric mean on column scales
-          for (iColumn = 0; iColumn < numberColumns; iColumn++) {
-            if (usefulColumn[iColumn]) {
-              CoinBigIndex j;
-              largest = 1.0e-50;
-              smallest = 1.0e50;
-              for (j = columnStart[iColumn];
-                   j < columnStart[iColumn] + columnLength[iColumn]; j++) {
-                iRow = row[j];
-                double value = fabs(elementByColumn[j]);
-                value *= rowScale[iRow];
-                largest = CoinMax(largest, value);
-                smallest = CoinMin(smallest, value);
-              }
+          columnInfo.numberAdded = 2;
 #ifdef USE_OBJECTIVE
-              if (fabs(objective[iColumn]) > 1.0e-20) {
-                double value = fabs(objective[iColumn]) * objScale;
-                largest = CoinMax(largest, value);
-                smallest = CoinMin(smallest, value);
-              }
-#endif
-#ifdef SQRT_ARRAY
-              columnScale[iColumn] = smallest * largest;
-#else
-              columnScale[iColumn] = 1.0 / sqrt(smallest * largest);
+          columnInfo.solution = objective;
+          columnInfo.theta = objScale;
 #endif
-              //columnScale[iColumn]=CoinMax(1.0e-10,CoinMin(1.0e10,columnScale[iColumn]));
-            }
-          }
+          scalePass(columnInfo, numberColumns, numberThreads);
 #ifdef SQRT_ARRAY
           doSqrts(columnScale, numberColumns);
 #endif
@@ -4483,23 +4660,10 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
       // final pass to scale columns so largest is reasonable
       // See what smallest will be if largest is 1.0
       if (model->scalingFlag() != 5) {
-        overallSmallest = 1.0e50;
-        for (iColumn = 0; iColumn < numberColumns; iColumn++) {
-          if (usefulColumn[iColumn]) {
-            CoinBigIndex j;
-            largest = 1.0e-20;
-            smallest = 1.0e50;
-            for (j = columnStart[iColumn];
-                 j < columnStart[iColumn] + columnLength[iColumn]; j++) {
-              iRow = row[j];
-              double value = fabs(elementByColumn[j] * rowScale[iRow]);
-              largest = CoinMax(largest, value);
-              smallest = CoinMin(smallest, value);
-            }
-            if (overallSmallest * largest > smallest)
-              overallSmallest = smallest / largest;
-          }
-        }
+        columnInfo.numberAdded = 3;
+        columnInfo.bestPossible = 1.0e50;
+        scalePass(columnInfo, numberColumns, numberThreads);
+        overallSmallest = columnInfo.bestPossible;
       }
       if (scalingMethod == 1 || scalingMethod == 2) {
         finished = true;
@@ -4722,18 +4886,14 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
       const int *COIN_RESTRICT column = rowCopy->getIndices();
       const CoinBigIndex *COIN_RESTRICT rowStart = rowCopy->getVectorStarts();
       // scale row copy
-      for (iRow = 0; iRow < numberRows; iRow++) {
-        CoinBigIndex j;
-        double scale = rowScale[iRow];
-        double *COIN_RESTRICT elementsInThisRow = element + rowStart[iRow];
-        const int *COIN_RESTRICT columnsInThisRow = column + rowStart[iRow];
-        int number = static_cast< int >(rowStart[iRow + 1] - rowStart[iRow]);
-        assert(number <= numberColumns);
-        for (j = 0; j < number; j++) {
-          int iColumn = columnsInThisRow[j];
-          elementsInThisRow[j] *= scale * columnScale[iColumn];
-        }
-      }
+      clpTempInfo info[2];
+      memset(info, 0, sizeof(info));
+      info[0].numberAdded = 4;
+      info[0].work = element;
+      info[0].start = rowStart;
+      info[0].row = column;
+      info[0].cost = rowScale;
+      info[0].lower = columnScale;
       if ((model->specialOptions() & 262144) != 0) {
         //if ((model->specialOptions()&(COIN_CBC_USING_CLP|16384))!=0) {
         //if (model->inCbcBranchAndBound()&&false) {
@@ -4741,25 +4901,18 @@ int ClpPackedMatrix::scale(ClpModel *model, ClpSimplex *simplex) const
         CoinPackedMatrix *scaledMatrix = new CoinPackedMatrix(*matrix_, 0, 0);
         ClpPackedMatrix *scaled = new ClpPackedMatrix(scaledMatrix);
         model->setClpScaledMatrix(scaled);
-        // get matrix data pointers
-        const int *COIN_RESTRICT row = scaledMatrix->getIndices();
-        const CoinBigIndex *COIN_RESTRICT columnStart = scaledMatrix->getVectorStarts();
-#ifndef NDEBUG
-        const int *COIN_RESTRICT columnLength = scaledMatrix->getVectorLengths();
-#endif
-        double *COIN_RESTRICT elementByColumn = scaledMatrix->getMutableElements();
-        for (iColumn = 0; iColumn < numberColumns; iColumn++) {
-          CoinBigIndex j;
-          double scale = columnScale[iColumn];
-          assert(columnStart[iColumn + 1] == columnStart[iColumn] + columnLength[iColumn]);
-          for (j = columnStart[iColumn];
-               j < columnStart[iColumn + 1]; j++) {
-            int iRow = row[j];
-            elementByColumn[j] *= scale * rowScale[iRow];
-          }
-        }
+        // scale both copies in same sweep
+        info[1].numberAdded = 5;
+        info[1].work = scaledMatrix->getMutableElements();
+        info[1].start = scaledMatrix->getVectorStarts();
+        info[1].row = scaledMatrix->getIndices();
+        info[1].cost = columnScale;
+        info[1].lower = rowScale;
+        scaleCopies(info, numberRows, numberColumns,
+          scaleThreads(matrix_->getNumElements()));
       } else {
         //printf("not in b&b\n");
+        scalePass(info[0], numberRows, scaleThreads(matrix_->getNumElements()));
       }
     } else {
       // no row copy
@@ -4788,23 +4941,15 @@ void ClpPackedMatrix::createScaledMatrix(ClpSimplex *model) const
   CoinPackedMatrix *scaledMatrix = new CoinPackedMatrix(*matrix_, 0, 0);
   ClpPackedMatrix *scaled = new ClpPackedMatrix(scaledMatrix);
   model->setClpScaledMatrix(scaled);
-  // get matrix data pointers
-  const int *COIN_RESTRICT row = scaledMatrix->getIndices();
-  const CoinBigIndex *COIN_RESTRICT columnStart = scaledMatrix->getVectorStarts();
-#ifndef NDEBUG
-  const int *COIN_RESTRICT columnLength = scaledMatrix->getVectorLengths();
-#endif
-  double *COIN_RESTRICT elementByColumn = scaledMatrix->getMutableElements();
-  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
-    CoinBigIndex j;
-    double scale = columnScale[iColumn];
-    assert(columnStart[iColumn + 1] == columnStart[iColumn] + columnLength[iColumn]);
-    for (j = columnStart[iColumn];
-         j < columnStart[iColumn + 1]; j++) {
-      int iRow = row[j];
-      elementByColumn[j] *= scale * rowScale[iRow];
-    }
-  }
+  clpTempInfo info;
+  memset(&info, 0, sizeof(clpTempInfo));
+  info.numberAdded = 5;
+  info.work = scaledMatrix->getMutableElements();
+  info.start = scaledMatrix->getVectorStarts();
+  info.row = scaledMatrix->getIndices();
+  info.cost = columnScale;
+  info.lower = rowScale;
+  scalePass(info, numberColumns, scaleThreads(scaledMatrix->getNumElements()));
 #ifdef DO_CHECK_FLAGS
   checkFlags(0);
 #endif
@@ -5099,6 +5244,136 @@ bool ClpPackedMatrix::allElementsInRange(ClpModel *model,
     flags_ |= 2; // will have gaps
   return true;
 }
+// For dropping zeros and merging duplicates by blocks of columns
+typedef struct {
+  const CoinBigIndex *COIN_RESTRICT columnStart;
+  int *COIN_RESTRICT columnLength;
+  int *COIN_RESTRICT row;
+  double *COIN_RESTRICT element;
+  CoinBigIndex *COIN_RESTRICT mark;
+  CoinBigIndex numberDeleted;
+  int numberDuplicates;
+  int startColumn;
+  int numberToDo;
+  int type;
+} clpCleanInfo;
+static void
+cleanElementsBit(clpCleanInfo &info)
+{
+  const CoinBigIndex *COIN_RESTRICT columnStart = info.columnStart;
+  int *COIN_RESTRICT columnLength = info.columnLength;
+  int *COIN_RESTRICT row = info.row;
+  double *COIN_RESTRICT element = info.element;
+  CoinBigIndex *COIN_RESTRICT mark = info.mark;
+  bool dropZeros = (info.type & 1) != 0;
+  int numberDuplicates = 0;
+  CoinBigIndex numberDeleted = 0;
+  int last = info.startColumn + info.numberToDo;
+  for (int iColumn = info.startColumn; iColumn < last; iColumn++) {
+    CoinBigIndex start = columnStart[iColumn];
+    CoinBigIndex end = start + columnLength[iColumn];
+    CoinBigIndex put = start;
+    int numberDuplicatesBefore = numberDuplicates;
+    for (CoinBigIndex j = start; j < end; j++) {
+      int iRow = row[j];
+      double value = element[j];
+      if (!value && dropZeros)
+        continue;
+      if (mark) {
+        if (mark[iRow] >= 0) {
+          // duplicate - add in
+          element[mark[iRow]] += value;
+          numberDuplicates++;
+          continue;
+        }
+        mark[iRow] = put;
+      }
+      row[put] = iRow;
+      element[put++] = value;
+    }
+    if (mark) {
+      for (CoinBigIndex j = start; j < put; j++)
+        mark[row[j]] = -1;
+      if (dropZeros && numberDuplicates > numberDuplicatesBefore) {
+        // merged duplicates may have cancelled out
+        CoinBigIndex put2 = start;
+        for (CoinBigIndex j = start; j < put; j++) {
+          if (element[j]) {
+            row[put2] = row[j];
+            element[put2++] = element[j];
+          }
+        }
+        put = put2;
+      }
+    }
+    numberDeleted += end - put;
+    columnLength[iColumn] = static_cast< int >(put - start);
+  }
+  info.numberDuplicates = numberDuplicates;
+  info.numberDeleted = numberDeleted;
+}
+/* Drops explicit zero elements (type 1) and/or merges duplicate
+   elements in a column by adding them (type 2).  With both, merged
+   elements which come to zero are dropped as well.  Done by blocks of
+   columns in parallel if threads available.
+   Returns number of duplicates merged */
+int ClpPackedMatrix::cleanElements(int type)
+{
+  int numberRows = matrix_->getNumRows();
+  int numberColumns = matrix_->getNumCols();
+  if (!numberColumns || !(type & 3))
+    return 0;
+  int numberThreads = 1;
+#if ABOCA_LITE
+  clpCleanInfo info[ABOCA_LITE];
+  if (abcState())
+    numberThreads = CoinMin(abcState(), ABOCA_LITE);
+#else
+  clpCleanInfo info[1];
+#endif
+  int chunk = (numberColumns + numberThreads - 1) / numberThreads;
+  int n = 0;
+  for (int i = 0; i < numberThreads; i++) {
+    info[i].columnStart = matrix_->getVectorStarts();
+    info[i].columnLength = matrix_->getMutableVectorLengths();
+    info[i].row = matrix_->getMutableIndices();
+    info[i].element = matrix_->getMutableElements();
+    info[i].mark = NULL;
+    if ((type & 2) != 0) {
+      info[i].mark = new CoinBigIndex[numberRows];
+      CoinFillN(info[i].mark, numberRows, static_cast< CoinBigIndex >(-1));
+    }
+    info[i].startColumn = n;
+    info[i].numberToDo = CoinMax(CoinMin(chunk, numberColumns - n), 0);
+    info[i].type = type;
+    n += chunk;
+  }
+#if ABOCA_LITE
+  if (numberThreads > 1) {
+    for (int i = 0; i < numberThreads; i++)
+      cilk_spawn cleanElementsBit(info[i]);
+    cilk_sync;
+  } else {
+#endif
+    cleanElementsBit(info[0]);
+#if ABOCA_LITE
+  }
+#endif
+  int numberDuplicates = 0;
+  CoinBigIndex numberDeleted = 0;
+  for (int i = 0; i < numberThreads; i++) {
+    numberDuplicates += info[i].numberDuplicates;
+    numberDeleted += info[i].numberDeleted;
+    delete[] info[i].mark;
+  }
+  if (numberDeleted) {
+    matrix_->setNumElements(matrix_->getNumElements() - numberDeleted);
+    flags_ |= 0x02;
+  }
+  if ((type & 1) != 0)
+    flags_ &= ~1; // no zero elements
+  return numberDuplicates;
+}
 int ClpPackedMatrix::gutsOfTransposeTimesByRowGE3a(const CoinIndexedVector *COIN_RESTRICT piVector,
   int *COIN_RESTRICT index,
   double *COIN_RESTRICT output,
@@ -5300,9 +5575,173 @@ bool ClpPackedMatrix::canDoPartialPricing() const
   return true;
 }
 // Partial pricing
+#if ABOCA_LITE
+// Below this many columns in slice partial pricing is done serially
+#ifndef CLP_PARTIAL_PRICING_PARALLEL
+#define CLP_PARTIAL_PRICING_PARALLEL 10000
+#endif
+/* Partial pricing for a block of a slice.
+   work - duals, lower/upper - row/column scale (may be NULL),
+   numberRemaining - number wanted, numberInfeasibilities - number found
+   beyond which give up after numberColumns columns,
+   bestPossible - best dj so far, numberAdded - best sequence (-1 if none) */
+static void
+partialPricingBit(clpTempInfo &info)
+{
+  const double *COIN_RESTRICT element = info.element;
+  const int *COIN_RESTRICT row = info.row;
+  const CoinBigIndex *COIN_RESTRICT startColumn = info.start;
+  const int *COIN_RESTRICT length = info.which;
+  const double *COIN_RESTRICT duals = info.work;
+  const double *COIN_RESTRICT cost = info.cost;
+  const double *COIN_RESTRICT rowScale = info.lower;
+  const double *COIN_RESTRICT columnScale = info.upper;
+  const unsigned char *COIN_RESTRICT status = info.status;
+  double tolerance = info.tolerance;
+  double bestDj = info.bestPossible;
+  int bestSequence = -1;
+  int sequenceOut = info.numberColumns;
+  int numberWanted = info.numberRemaining;
+  int numberFound = 0;
+  int giveUp = info.numberInfeasibilities;
+  int first = info.startColumn;
+  int last = first + info.numberToDo;
+  int lastScan = CoinMin(first + static_cast< int >(info.theta), last);
+  for (int iSequence = first; iSequence < last; iSequence++) {
+    int iStatus = status[iSequence] & 7;
+    if (iSequence != sequenceOut && iStatus != ClpSimplex::basic && iStatus != ClpSimplex::isFixed) {
+      double value = 0.0;
+      CoinBigIndex end = startColumn[iSequence] + length[iSequence];
+      if (rowScale) {
+        for (CoinBigIndex j = startColumn[iSequence]; j < end; j++) {
+          int jRow = row[j];
+          value -= duals[jRow] * element[j] * rowScale[jRow];
+        }
+        value = cost[iSequence] + value * columnScale[iSequence];
+      } else {
+        value = cost[iSequence];
+        for (CoinBigIndex j = startColumn[iSequence]; j < end; j++) {
+          int jRow = row[j];
+          value -= duals[jRow] * element[j];
+        }
+      }
+      bool good;
+      if (iStatus == ClpSimplex::atUpperBound) {
+        good = value > tolerance;
+      } else if (iStatus == ClpSimplex::atLowerBound) {
+        value = -value;
+        good = value > tolerance;
+      } else {
+        value = fabs(value);
+        good = value > FREE_ACCEPT * tolerance;
+        // we are going to bias towards free (but only if reasonable)
+        value *= FREE_BIAS;
+      }
+      if (good) {
+        // flagged variables do not count
+        if ((status[iSequence] & 64) == 0) {
+          numberFound++;
+          if (value > bestDj) {
+            bestDj = value;
+            bestSequence = iSequence;
+          }
+        }
+      }
+    }
+    if (numberFound > giveUp && iSequence > lastScan)
+      break;
+    if (numberFound >= numberWanted)
+      break;
+  }
+  info.bestPossible = bestDj;
+  info.numberAdded = bestSequence;
+  info.numberRemaining = numberFound;
+}
+#endif
 void ClpPackedMatrix::partialPricing(ClpSimplex *model, double startFraction, double endFraction,
   int &bestSequence, int &numberWanted)
 {
+#if ABOCA_LITE
+  int numberThreads = abcState();
+  int startX = static_cast< int >(startFraction * numberActiveColumns_);
+  int endX = CoinMin(static_cast< int >(endFraction * numberActiveColumns_ + 1), numberActiveColumns_);
+  if (numberThreads > 1 && endX - startX > CLP_PARTIAL_PRICING_PARALLEL) {
+    // price sub-slices in parallel and take best
+    numberWanted = currentWanted_;
+    double tolerance = model->currentDualTolerance();
+    double bestDj;
+    if (bestSequence >= 0)
+      bestDj = fabs(model->clpMatrix()->reducedCost(model, bestSequence));
+    else
+      bestDj = tolerance;
+    int minNeg = minimumGoodReducedCosts_ == -1 ? numberWanted : minimumGoodReducedCosts_;
+    int giveUp = numberWanted - originalWanted_ + minNeg;
+    if (giveUp > 0)
+      giveUp /= numberThreads;
+    int scan = minimumObjectsScan_ < 0 ? endX - startX : minimumObjectsScan_;
+    clpTempInfo info[ABOCA_LITE];
+    int chunk = (endX - startX + numberThreads - 1) / numberThreads;
+    int n = startX;
+    for (int i = 0; i < numberThreads; i++) {
+      info[i].element = matrix_->getElements();
+      info[i].row = matrix_->getIndices();
+      info[i].start = matrix_->getVectorStarts();
+      info[i].which = const_cast< int * >(matrix_->getVectorLengths());
+      info[i].work = const_cast< double * >(model->dualRowSolution());
+      info[i].cost = model->costRegion();
+      info[i].lower = model->rowScale();
+      info[i].upper = model->columnScale();
+      info[i].status = model->statusArray();
+      info[i].tolerance = tolerance;
+      info[i].bestPossible = bestDj;
+      info[i].numberColumns = model->sequenceOut();
+      info[i].numberRemaining = (numberWanted + numberThreads - 1) / numberThreads;
+      info[i].numberInfeasibilities = giveUp;
+      info[i].theta = (scan + numberThreads - 1) / numberThreads;
+      info[i].startColumn = n;
+      info[i].numberToDo = CoinMax(CoinMin(chunk, endX - n), 0);
+      n += chunk;
+    }
+    for (int i = 0; i < numberThreads; i++)
+      cilk_spawn partialPricingBit(info[i]);
+    cilk_sync;
+    int saveSequence = bestSequence;
+    for (int i = 0; i < numberThreads; i++) {
+      numberWanted -= info[i].numberRemaining;
+      if (info[i].numberAdded >= 0 && info[i].bestPossible > bestDj) {
+        bestDj = info[i].bestPossible;
+        bestSequence = info[i].numberAdded;
+      }
+    }
+    numberWanted = CoinMax(numberWanted, 0);
+    if (bestSequence != saveSequence) {
+      // recompute dj
+      const double *COIN_RESTRICT element = matrix_->getElements();
+      const int *COIN_RESTRICT row = matrix_->getIndices();
+      const double *COIN_RESTRICT rowScale = model->rowScale();
+      const double *COIN_RESTRICT duals = model->dualRowSolution();
+      CoinBigIndex start = matrix_->getVectorStarts()[bestSequence];
+      CoinBigIndex end = start + matrix_->getVectorLengths()[bestSequence];
+      double value = 0.0;
+      if (rowScale) {
+        for (CoinBigIndex j = start; j < end; j++) {
+          int jRow = row[j];
+          value -= duals[jRow] * element[j] * rowScale[jRow];
+        }
+        value *= model->columnScale()[bestSequence];
+      } else {
+        for (CoinBigIndex j = start; j < end; j++)
+          value -= duals[row[j]] * element[j];
+      }
+      double *COIN_RESTRICT reducedCost = model->djRegion();
+      reducedCost[bestSequence] = model->costRegion()[bestSequence] + value;
+      savedBestSequence_ = bestSequence;
+      savedBestDj_ = reducedCost[savedBestSequence_];
+    }
+    currentWanted_ = numberWanted;
+    return;
+  }
+#endif
   numberWanted = currentWanted_;
   int start = static_cast< int >(startFraction * numberActiveColumns_);
   int end = CoinMin(static_cast< int >(endFraction * numberActiveColumns_ + 1), numberActiveColumns_);
@@ -5595,9 +6034,6 @@ void ClpPackedMatrix::scaleRowCopy(ClpModel *model) const
   if (model->rowCopy()) {
     // need to replace row by row
     int numberRows = model->numberRows();
-#ifndef NDEBUG
-    int numberColumns = matrix_->getNumCols();
-#endif
     ClpMatrixBase *rowCopyBase = model->rowCopy();
 #ifndef NDEBUG
     ClpPackedMatrix *rowCopy = dynamic_cast< ClpPackedMatrix * >(rowCopyBase);
@@ -5613,18 +6049,15 @@ void ClpPackedMatrix::scaleRowCopy(ClpModel *model) const
     const double *COIN_RESTRICT rowScale = model->rowScale();
     const double *COIN_RESTRICT columnScale = model->columnScale();
     // scale row copy
-    for (int iRow = 0; iRow < numberRows; iRow++) {
-      CoinBigIndex j;
-      double scale = rowScale[iRow];
-      double *COIN_RESTRICT elementsInThisRow = element + rowStart[iRow];
-      const int *COIN_RESTRICT columnsInThisRow = column + rowStart[iRow];
-      int number = static_cast< int >(rowStart[iRow + 1] - rowStart[iRow]);
-      assert(number <= numberColumns);
-      for (j = 0; j < number; j++) {
-        int iColumn = columnsInThisRow[j];
-        elementsInThisRow[j] *= scale * columnScale[iColumn];
-      }
-    }
+    clpTempInfo info;
+    memset(&info, 0, sizeof(clpTempInfo));
+    info.numberAdded = 4;
+    info.work = element;
+    info.start = rowStart;
+    info.row = column;
+    info.cost = rowScale;
+    info.lower = columnScale;
+    scalePass(info, numberRows, scaleThreads(rowCopy->getNumElements()));
   }
 }
 /* Realy really scales column copy
@@ -159,6 +159,14 @@ public:
   virtual bool allElementsInRange(ClpModel *model,
     double smallest, double largest,
     int check = 15);
+  /** Cleans matrix in place without copying -
+         1 - drop explicit zero elements
+         2 - merge duplicates by adding
+         (3 also drops merged elements which come to zero)
+     Done by blocks of columns in parallel if threads available.
+     Returns number of duplicates merged.
+     */
+  int cleanElements(int type);
   /** Returns largest and smallest elements of both signs.
          Largest refers to largest absolute value.
      */
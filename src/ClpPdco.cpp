@@ -246,7 +246,7 @@ int ClpPdco::pdco(ClpPdcoBase *stuff, Options &options, Info &info, Outfo &outfo
   double z0min = options.z0min;
   double mu0 = options.mu0;
   int LSproblem = options.LSproblem; // See below
-  int LSmethod = options.LSmethod; // 1=Cholesky    2=QR    3=LSQR
+  int LSmethod = options.LSmethod; // 1=Cholesky    2=QR    3=LSQR    4=PCG
   int itnlim = options.LSQRMaxIter * CoinMin(m, n);
   double atol1 = options.LSQRatol1; // Initial  atol
   double atol2 = options.LSQRatol2; // Smallest atol,unless atol1 is smaller
@@ -312,7 +312,7 @@ int ClpPdco::pdco(ClpPdcoBase *stuff, Options &options, Info &info, Outfo &outfo
   //bool useQR   = (LSmethod == 2);
   bool direct = (LSmethod <= 2 && ifexplicit);
   char solver[7];
-  strcpy(solver, "  LSQR");
+  strcpy(solver, LSmethod == 4 ? "   PCG" : "  LSQR");
 
   //---------------------------------------------------------------------
   // Categorize bounds and allow for fixed variables by modifying b.
@@ -623,8 +623,12 @@ int ClpPdco::pdco(ClpPdcoBase *stuff, Options &options, Info &info, Outfo &outfo
         info.atolmin = atolmin;
         info.r3norm = fmerit; // Must be the 2-norm here.
 
-        thisLsqr.do_lsqr(rhs, damp, atol, btol, conlim, itnlim,
-          show, info, dy, &istop, &itncg, &outfo, precon, Pr);
+        if (LSmethod == 4)
+          thisLsqr.do_cgls(rhs, damp, atol, btol, conlim, itnlim,
+            show, info, dy, &istop, &itncg, &outfo, precon, Pr);
+        else
+          thisLsqr.do_lsqr(rhs, damp, atol, btol, conlim, itnlim,
+            show, info, dy, &istop, &itncg, &outfo, precon, Pr);
         if (precon)
           dy = dy * Pr;
 
@@ -884,6 +888,13 @@ int ClpPdco::pdco(ClpPdcoBase *stuff, Options &options, Info &info, Outfo &outfo
   printf("    max |y| =%10.3f", y.infNorm());
   printf("    max |z| =%10.3f", z.infNorm());
   printf(" unscaled\n");
+  // Keep solution in model
+  if (columnActivity_) {
+    CoinMemcpyN(x.getElements(), n, columnActivity_);
+    CoinMemcpyN(z.getElements(), n, reducedCost_);
+    CoinMemcpyN(y.getElements(), m, dual_);
+    objectiveValue_ = getObj(x);
+  }
 
   time = CoinCpuTime() - time;
   char str1[100], str2[100];
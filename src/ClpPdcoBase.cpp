@@ -6,8 +6,14 @@
 
 #include <iostream>
 
+#include "CoinHelperFunctions.hpp"
 #include "ClpPdcoBase.hpp"
 #include "ClpPdco.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
+#include "ClpSimplex.hpp"
 
 //#############################################################################
 // Constructors / Destructor / Assignment
@@ -54,5 +60,133 @@ ClpPdcoBase::operator=(const ClpPdcoBase &rhs)
   return *this;
 }
 
+// Elements in matrix before products are split between threads
+#define CLP_PDCO_PARALLEL 10000
+typedef struct {
+  const CoinBigIndex *start;
+  const int *length;
+  const int *row;
+  const double *element;
+  const double *in;
+  double *out;
+  int first;
+  int last;
+  int mode;
+} clpPdcoInfo;
+/* Columns first to last-1 of -
+   mode 1 out += A*in, 2 out += A'*in, 3 out += (A*in)^2 elementwise */
+static void
+matrixVecMultBit(clpPdcoInfo &info)
+{
+  const CoinBigIndex *COIN_RESTRICT columnStart = info.start;
+  const int *COIN_RESTRICT columnLength = info.length;
+  const int *COIN_RESTRICT row = info.row;
+  const double *COIN_RESTRICT element = info.element;
+  const double *COIN_RESTRICT in = info.in;
+  double *COIN_RESTRICT out = info.out;
+  for (int iColumn = info.first; iColumn < info.last; iColumn++) {
+    CoinBigIndex start = columnStart[iColumn];
+    CoinBigIndex end = start + columnLength[iColumn];
+    if (info.mode == 2) {
+      double value = 0.0;
+      for (CoinBigIndex j = start; j < end; j++)
+        value += in[row[j]] * element[j];
+      out[iColumn] += value;
+    } else {
+      double value = in[iColumn];
+      if (!value)
+        continue;
+      if (info.mode == 1) {
+        for (CoinBigIndex j = start; j < end; j++)
+          out[row[j]] += value * element[j];
+      } else {
+        for (CoinBigIndex j = start; j < end; j++) {
+          double product = value * element[j];
+          out[row[j]] += product * product;
+        }
+      }
+    }
+  }
+}
+// Does product - threads get columns with same number of elements
+static void
+matrixVecMultAll(const CoinPackedMatrix *matrix, int mode, double *x,
+  const double *y)
+{
+  clpPdcoInfo info;
+  info.start = matrix->getVectorStarts();
+  info.length = matrix->getVectorLengths();
+  info.row = matrix->getIndices();
+  info.element = matrix->getElements();
+  info.in = y;
+  info.out = x;
+  info.first = 0;
+  info.last = matrix->getNumCols();
+  info.mode = mode;
+#if ABOCA_LITE
+  int numberThreads = abcState();
+  CoinBigIndex numberElements = matrix->getNumElements();
+  if (numberThreads > 1 && numberElements > CLP_PDCO_PARALLEL) {
+    clpPdcoInfo infos[ABOCA_LITE];
+    int numberColumns = matrix->getNumCols();
+    int numberRows = matrix->getNumRows();
+    double *work = NULL;
+    if (mode != 2) {
+      // rows scattered so each block needs own copy
+      work = new double[(numberThreads - 1) * numberRows];
+      CoinZeroN(work, (numberThreads - 1) * numberRows);
+    }
+    CoinBigIndex chunk = numberElements / numberThreads + 1;
+    CoinBigIndex done = 0;
+    int iColumn = 0;
+    for (int i = 0; i < numberThreads; i++) {
+      infos[i] = info;
+      infos[i].first = iColumn;
+      while (iColumn < numberColumns && done < (i + 1) * chunk)
+        done += info.length[iColumn++];
+      if (i == numberThreads - 1)
+        iColumn = numberColumns;
+      infos[i].last = iColumn;
+      if (i && work)
+        infos[i].out = work + (i - 1) * numberRows;
+    }
+    for (int i = 0; i < numberThreads; i++) {
+      cilk_spawn matrixVecMultBit(infos[i]);
+    }
+    cilk_sync;
+    if (work) {
+      // add in same order whatever threads did
+      for (int i = 1; i < numberThreads; i++) {
+        const double *other = work + (i - 1) * numberRows;
+        for (int k = 0; k < numberRows; k++)
+          x[k] += other[k];
+      }
+      delete[] work;
+    }
+    return;
+  }
+#endif
+  matrixVecMultBit(info);
+}
+// mode 1 x += A*y, mode 2 x += A'*y using model's matrix
+void ClpPdcoBase::matrixVecMult(ClpInterior *model, int mode, double *x, double *y) const
+{
+  const CoinPackedMatrix *matrix = model->matrix();
+  assert(matrix->isColOrdered());
+  matrixVecMultAll(matrix, mode, x, y);
+}
+// Diagonal preconditioner from model's matrix
+void ClpPdcoBase::matrixPrecon(ClpInterior *model, double delta, double *x, double *y) const
+{
+  const CoinPackedMatrix *matrix = model->matrix();
+  assert(matrix->isColOrdered());
+  int numberRows = model->numberRows();
+  CoinZeroN(x, numberRows);
+  matrixVecMultAll(matrix, 3, x, y);
+  double delta2 = delta * delta;
+  for (int iRow = 0; iRow < numberRows; iRow++)
+    x[iRow] = 1.0 / sqrt(x[iRow] + delta2);
+}
+
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
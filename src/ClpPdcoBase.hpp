@@ -73,6 +73,16 @@ public:
     return d2_;
   };
   //@}
+  //@{
+  ///@name Helpers if A is matrix in model
+  /** mode 1 x += A*y, mode 2 x += A'*y using model's matrix.
+      Split between threads if ABOCA_LITE.  matVecMult can just call this */
+  void matrixVecMult(ClpInterior *model, int mode, double *x, double *y) const;
+  /** Diagonal preconditioner from model's matrix -
+      x[i] = 1/sqrt(sum_j (a_ij*y_j)^2 + delta^2).
+      matPrecon can just call this */
+  void matrixPrecon(ClpInterior *model, double delta, double *x, double *y) const;
+  //@}
 
 protected:
   /**@name Constructors, destructor<br>
@@ -69,6 +69,13 @@ static CoinWorkDouble eBase = 1.0e-12;
 static CoinWorkDouble eDiagonal = 1.0e25;
 static CoinWorkDouble eDiagonalCaution = 1.0e18;
 static CoinWorkDouble eExtra = 1.0e-12;
+/* Centrality correctors reuse the factorization so the number worth trying
+   depends on how expensive factorize is relative to a solve (Gondzio).
+   The costs are estimated from the factor so the choice (and so the
+   iterations) is the same on every run. */
+#ifndef CLP_MAXIMUM_CORRECTORS
+#define CLP_MAXIMUM_CORRECTORS 10
+#endif
 
 // main function
 
@@ -136,8 +143,16 @@ int ClpPredictorCorrector::solve()
 
   //bool firstTime=true;
   //firstFactorization(true);
-  int returnCode = cholesky_->order(this);
-  if (returnCode || cholesky_->symbolic()) {
+  // Ordering and symbolic can be kept (or restored) if structure same
+  unsigned int structureHash = ClpScaleCache::patternHash(this);
+  int returnCode = 0;
+  if (!cholesky_->reuseStructure(this, structureHash)) {
+    returnCode = cholesky_->order(this);
+    if (!returnCode)
+      returnCode = cholesky_->symbolic();
+    cholesky_->setStructure(this, returnCode ? 0 : structureHash);
+  }
+  if (returnCode) {
     COIN_DETAIL_PRINT(printf("Error return from symbolic - probably not enough memory\n"));
     problemStatus_ = 4;
     //delete all temporary regions
@@ -159,9 +174,19 @@ int ClpPredictorCorrector::solve()
   //set iterations
   numberIterations_ = -1;
   int numberTotal = numberRows_ + numberColumns_;
+  // save duals from model for warm start
+  double *warmDual = NULL;
+  if (warmStart_ && !quadraticObj) {
+#if COIN_LONG_WORK
+    warmDual = CoinCopyOfArray(dualSave, numberRows_);
+#else
+    warmDual = CoinCopyOfArray(dual_, numberRows_);
+#endif
+  }
   //initialize solution here
   if (createSolution() < 0) {
     COIN_DETAIL_PRINT(printf("Not enough memory\n"));
+    delete[] warmDual;
     problemStatus_ = 4;
     //delete all temporary regions
     deleteWorkingData();
@@ -176,6 +201,10 @@ int ClpPredictorCorrector::solve()
   // Could try centering steps without any original step i.e. just center
   //firstFactorization(false);
   CoinZeroN(dualArray, numberRows_);
+  if (warmDual) {
+    warmStartSolution(warmDual);
+    delete[] warmDual;
+  }
   multiplyAdd(solution_ + numberColumns_, numberRows_, -1.0, errorRegion_, 0.0);
   matrix_->times(1.0, solution_, errorRegion_);
   maximumRHSError_ = maximumAbsElement(errorRegion_, numberRows_);
@@ -825,7 +854,8 @@ int ClpPredictorCorrector::solve()
       goodMove = false; // don't bother
     if ((modeSwitch & 1) != 0)
       goodMove = false;
-    while (goodMove && numberTries < 5) {
+    int maximumTries = maximumCorrectors();
+    while (goodMove && numberTries < maximumTries) {
       goodMove = false;
       numberTries++;
       CoinMemcpyN(deltaX_, numberTotal, saveX);
@@ -984,6 +1014,40 @@ int ClpPredictorCorrector::solve()
   }
   return problemStatus_;
 }
+/* Number of centrality correctors worth trying.
+   Factorize costs about sum of squares of factor column counts which is
+   estimated as size*size/numberRows.  A solve costs two passes through
+   the factor and two through the matrix.  As in Gondzio's table one more
+   corrector for each band of ratio and then one more each time ratio
+   doubles so problems where factorize dominates can use many. */
+int ClpPredictorCorrector::maximumCorrectors() const
+{
+  if (correctorLimit_ > 0)
+    return correctorLimit_;
+  if (!cholesky_ || !cholesky_->size() || !numberRows_)
+    return 5; // not known
+  double size = cholesky_->size();
+  double factorCost = (size * size) / numberRows_;
+  double solveCost = 2.0 * size + 2.0 * matrix_->getNumElements() + numberRows_;
+  double ratio = factorCost / solveCost;
+  int number;
+  if (ratio <= 2.0) {
+    number = 1;
+  } else if (ratio <= 10.0) {
+    number = 2;
+  } else if (ratio <= 30.0) {
+    number = 3;
+  } else if (ratio <= 50.0) {
+    number = 4;
+  } else {
+    number = 5;
+    while (ratio > 100.0 && number < CLP_MAXIMUM_CORRECTORS) {
+      number++;
+      ratio *= 0.5;
+    }
+  }
+  return CoinMin(number, CLP_MAXIMUM_CORRECTORS);
+}
 // findStepLength.
 //phase  - 0 predictor
 //         1 corrector
@@ -1927,6 +1991,8 @@ int ClpPredictorCorrector::createSolution()
           }
         }
       }
+      // elements changed in place
+      quadraticObj->markChanged();
     }
   }
   baseObjectiveNorm_ = objectiveNorm_;
@@ -2336,6 +2402,103 @@ int ClpPredictorCorrector::createSolution()
 #endif
   return 0;
 }
+/* warmStartSolution.  Replaces starting point from createSolution by
+   solution in model (columnActivity_, rowActivity_ and rowDual) moved
+   warmStart_ (relative) into interior */
+void ClpPredictorCorrector::warmStartSolution(const double *rowDual)
+{
+  int numberTotal = numberRows_ + numberColumns_;
+  CoinWorkDouble *dualArray = reinterpret_cast< CoinWorkDouble * >(dual_);
+  // duals were unscaled by direction, objective scale and scaleFactor_
+  CoinWorkDouble dualMultiplier = 0.0;
+  if (optimizationDirection_)
+    dualMultiplier = objectiveScale_ / (optimizationDirection_ * scaleFactor_);
+  int i;
+  // fixed variables keep values from createSolution
+  for (i = 0; i < numberColumns_; i++) {
+    if (flagged(i))
+      continue;
+    CoinWorkDouble value = columnActivity_[i] * rhsScale_;
+    if (rowScale_)
+      value /= columnScale_[i];
+    solution_[i] = value;
+  }
+  for (i = 0; i < numberRows_; i++) {
+    CoinWorkDouble value = rowActivity_[i] * rhsScale_;
+    CoinWorkDouble dualValue = rowDual[i] * dualMultiplier;
+    if (rowScale_) {
+      value *= rowScale_[i];
+      dualValue /= rowScale_[i];
+    }
+    if (!flagged(numberColumns_ + i))
+      solution_[numberColumns_ + i] = value;
+    dualArray[i] = dualValue;
+  }
+  // reduced costs
+  CoinMemcpyN(dualArray, numberRows_, dj_ + numberColumns_);
+  CoinMemcpyN(cost_, numberColumns_, dj_);
+  matrix_->transposeTimes(-1.0, dualArray, dj_);
+  CoinWorkDouble one = 1.0;
+  CoinWorkDouble zero = 0.0;
+  CoinWorkDouble warmStart = warmStart_;
+  CoinWorkDouble dualShift = warmStart * CoinMax(one, objectiveNorm_);
+  CoinWorkDouble gamma2 = gamma_ * gamma_;
+  // free variables are treated as if bounds this far away
+  CoinWorkDouble largeGap = CoinMax(static_cast< CoinWorkDouble >(1.0e7),
+    1.0e2 * maximumAbsElement(solution_, numberTotal));
+  for (i = 0; i < numberTotal; i++) {
+    if (flagged(i))
+      continue; // fixed
+    CoinWorkDouble lowerValue = lower_[i];
+    CoinWorkDouble upperValue = upper_[i];
+    CoinWorkDouble value = solution_[i];
+    CoinWorkDouble shift = warmStart * CoinMax(one, CoinAbs(value));
+    CoinWorkDouble reducedCost = dj_[i];
+    CoinWorkDouble gammaTerm = gamma2;
+    if (primalR_)
+      gammaTerm += primalR_[i];
+    if (lowerBound(i)) {
+      if (upperBound(i)) {
+        if (upperValue - lowerValue > 2.0 * shift)
+          value = CoinMax(lowerValue + shift, CoinMin(upperValue - shift, value));
+        else
+          value = 0.5 * (lowerValue + upperValue);
+        CoinWorkDouble s = value - lowerValue;
+        CoinWorkDouble t = upperValue - value;
+        zVec_[i] = CoinMax(reducedCost, zero) + dualShift;
+        wVec_[i] = CoinMax(-reducedCost, zero) + dualShift;
+        diagonal_[i] = (t * s) / (s * wVec_[i] + t * zVec_[i] + gammaTerm * t * s);
+        lowerSlack_[i] = s;
+        upperSlack_[i] = t;
+      } else {
+        value = CoinMax(value, lowerValue + shift);
+        CoinWorkDouble s = value - lowerValue;
+        zVec_[i] = CoinMax(reducedCost, zero) + dualShift;
+        wVec_[i] = 0.0;
+        diagonal_[i] = s / (zVec_[i] + s * gammaTerm);
+        lowerSlack_[i] = s;
+        upperSlack_[i] = 0.0;
+      }
+    } else if (upperBound(i)) {
+      value = CoinMin(value, upperValue - shift);
+      CoinWorkDouble t = upperValue - value;
+      zVec_[i] = 0.0;
+      wVec_[i] = CoinMax(-reducedCost, zero) + dualShift;
+      diagonal_[i] = t / (wVec_[i] + t * gammaTerm);
+      lowerSlack_[i] = 0.0;
+      upperSlack_[i] = t;
+    } else {
+      // free
+      zVec_[i] = 0.0;
+      wVec_[i] = 0.0;
+      diagonal_[i] = CoinMin(largeGap / (2.0 * dualShift + largeGap * gammaTerm), eDiagonal);
+      lowerSlack_[i] = 0.0;
+      upperSlack_[i] = 0.0;
+    }
+    solution_[i] = value;
+  }
+  solutionNorm_ = maximumAbsElement(solution_, numberTotal);
+}
 // complementarityGap.  Computes gap
 //phase 0=as is , 1 = after predictor , 2 after corrector
 CoinWorkDouble ClpPredictorCorrector::complementarityGap(int &numberComplementarityPairs,
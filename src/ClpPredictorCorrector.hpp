@@ -59,6 +59,12 @@ public:
   CoinWorkDouble findDirectionVector(const int phase);
   /// createSolution.  Creates solution from scratch (- code if no memory)
   int createSolution();
+  /** warmStartSolution.  After createSolution moves solution in model
+      and given duals into interior to use as starting point */
+  void warmStartSolution(const double *rowDual);
+  /** Number of centrality correctors worth trying - from estimated
+      cost of factorize relative to a solve */
+  int maximumCorrectors() const;
   /// complementarityGap.  Computes gap
   //phase 0=as is , 1 = after predictor , 2 after corrector
   CoinWorkDouble complementarityGap(int &numberComplementarityPairs, int &numberComplementarityItems,
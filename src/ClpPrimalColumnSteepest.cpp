@@ -208,6 +208,99 @@ pivotColumnBit(clpTempInfo &info)
   info.primalRatio = bestDj;
   info.numberAdded = bestSequence;
 }
+#if ABOCA_LITE
+// Below this many in updated row slacks in djsAndSteepest are done serially
+#ifndef CLP_PRIMAL_WEIGHTS_PARALLEL
+#define CLP_PRIMAL_WEIGHTS_PARALLEL 5000
+#endif
+/* Slack part of djsAndSteepest for a block of updated row.
+   Sequences which become infeasible are put in which (at same
+   positions as in index) so caller can add them to list */
+static void
+djsAndSteepestSlackBit(clpTempInfo &info)
+{
+  const int *COIN_RESTRICT index = info.index;
+  const double *COIN_RESTRICT updateBy = info.work;
+  double *COIN_RESTRICT reducedCost = info.reducedCost;
+  double *COIN_RESTRICT weight = info.spare;
+  const double *COIN_RESTRICT other = info.lower;
+  const unsigned char *COIN_RESTRICT status = info.status;
+  double *COIN_RESTRICT infeas = info.infeas;
+  int *COIN_RESTRICT added = info.which + info.startColumn;
+  const unsigned int *COIN_RESTRICT reference = reinterpret_cast< const unsigned int * >(info.row);
+  double tolerance = info.tolerance;
+  double scaleFactor = info.theta;
+  double devex = info.primalRatio;
+  double referenceIn = info.upperTheta;
+  bool steepest = info.bestPossible != 0.0;
+  int addSequence = info.numberColumns;
+  int numberAdded = 0;
+  int last = info.startColumn + info.numberToDo;
+  for (int j = info.startColumn; j < last; j++) {
+    int iSequence = index[j];
+    int jSequence = iSequence + addSequence;
+    int iStatus = status[jSequence] & 7;
+    if (iStatus == ClpSimplex::basic) {
+      if (infeas[jSequence])
+        infeas[jSequence] = COIN_INDEXED_REALLY_TINY_ELEMENT;
+      reducedCost[iSequence] = 0.0;
+      continue;
+    } else if (iStatus == ClpSimplex::isFixed) {
+      continue;
+    }
+    double value2 = updateBy[j];
+    double value = reducedCost[iSequence] - value2;
+    double thisWeight = weight[iSequence];
+    // row has -1
+    double pivot = value2 * scaleFactor;
+    double pivotSquared = pivot * pivot;
+    thisWeight += pivotSquared * devex + pivot * other[iSequence];
+    reducedCost[iSequence] = value;
+    if (thisWeight < TRY_NORM) {
+      if (steepest) {
+        thisWeight = CoinMax(TRY_NORM, ADD_ONE + pivotSquared);
+      } else {
+        // exact
+        thisWeight = referenceIn * pivotSquared;
+        if (((reference[jSequence >> 5] >> (jSequence & 31)) & 1) != 0)
+          thisWeight += 1.0;
+        thisWeight = CoinMax(thisWeight, TRY_NORM);
+      }
+    }
+    weight[iSequence] = thisWeight;
+    double infeasibility = 0.0;
+    if (iStatus == ClpSimplex::atUpperBound) {
+      if (value > tolerance) {
+#ifdef CLP_PRIMAL_SLACK_MULTIPLIER
+        infeasibility = value * value * CLP_PRIMAL_SLACK_MULTIPLIER;
+#else
+        infeasibility = value * value;
+#endif
+      }
+    } else if (iStatus == ClpSimplex::atLowerBound) {
+      if (value < -tolerance) {
+#ifdef CLP_PRIMAL_SLACK_MULTIPLIER
+        infeasibility = value * value * CLP_PRIMAL_SLACK_MULTIPLIER;
+#else
+        infeasibility = value * value;
+#endif
+      }
+    } else if (fabs(value) > FREE_ACCEPT * tolerance) {
+      // we are going to bias towards free (but only if reasonable)
+      value *= FREE_BIAS;
+      infeasibility = value * value;
+    }
+    if (infeasibility) {
+      if (!infeas[jSequence])
+        added[numberAdded++] = jSequence;
+      infeas[jSequence] = infeasibility;
+    } else if (infeas[jSequence]) {
+      infeas[jSequence] = COIN_INDEXED_REALLY_TINY_ELEMENT;
+    }
+  }
+  info.numberAdded = numberAdded;
+}
+#endif
 // Returns pivot column, -1 if none
 /*      The Packed CoinIndexedVector updates has cost updates - for normal LP
 	that is just +-weight where a feasibility changed.  It also has
@@ -1211,7 +1304,46 @@ void ClpPrimalColumnSteepest::djsAndSteepest(CoinIndexedVector *updates,
 #ifdef CLP_USER_DRIVEN
   model_->eventHandler()->eventWithInfo(ClpEventHandler::beforeChooseIncoming, updates);
 #endif
-
+#if ABOCA_LITE
+  int numberThreads = abcState();
+  if (numberThreads > 1 && number > CLP_PRIMAL_WEIGHTS_PARALLEL) {
+    // split updated row between threads - spareRow2 indices free
+    clpTempInfo info[ABOCA_LITE];
+    int chunk = (number + numberThreads - 1) / numberThreads;
+    int n = 0;
+    for (int i = 0; i < numberThreads; i++) {
+      info[i].index = index;
+      info[i].work = updateBy;
+      info[i].reducedCost = reducedCost;
+      info[i].spare = weight;
+      info[i].lower = other;
+      info[i].status = model_->statusArray();
+      info[i].infeas = infeas;
+      info[i].which = spareRow2->getIndices();
+      info[i].row = reinterpret_cast< const int * >(reference_);
+      info[i].tolerance = tolerance;
+      info[i].theta = scaleFactor;
+      info[i].primalRatio = devex_;
+      info[i].upperTheta = referenceIn;
+      info[i].bestPossible = (mode_ == 1) ? 1.0 : 0.0;
+      info[i].numberColumns = addSequence;
+      info[i].startColumn = n;
+      info[i].numberToDo = CoinMax(CoinMin(chunk, number - n), 0);
+      n += chunk;
+    }
+    for (int i = 0; i < numberThreads; i++)
+      cilk_spawn djsAndSteepestSlackBit(info[i]);
+    cilk_sync;
+    // add new infeasibilities to list in same order as serial code
+    const int *added = spareRow2->getIndices();
+    for (int i = 0; i < numberThreads; i++) {
+      for (int k = 0; k < info[i].numberAdded; k++) {
+        int iSequence = added[info[i].startColumn + k];
+        infeasible_->quickAdd(iSequence, infeas[iSequence]);
+      }
+    }
+  } else
+#endif
   for (j = 0; j < number; j++) {
     double thisWeight;
     double pivot;
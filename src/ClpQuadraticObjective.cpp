@@ -6,8 +6,137 @@
 #include "CoinHelperFunctions.hpp"
 #include "CoinIndexedVector.hpp"
 #include "ClpFactorization.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 #include "ClpSimplex.hpp"
 #include "ClpQuadraticObjective.hpp"
+// Elements in Q before product is split between threads
+#define CLP_QUADRATIC_PARALLEL 10000
+// Updates of Q*x before it is recomputed from scratch
+#define CLP_QUADRATIC_REFRESH 100
+typedef struct {
+  const CoinBigIndex *start;
+  const int *length;
+  const int *column;
+  const double *element;
+  const double *solution;
+  const double *scale;
+  double *product;
+  int first;
+  int last;
+  bool fullMatrix;
+} clpQuadraticInfo;
+/* Adds Q*solution for columns first to last-1 into product.
+   If half matrix then off diagonal elements also go into product[jColumn]
+   so product must not be shared with another block */
+static void
+quadraticTimesBit(clpQuadraticInfo &info)
+{
+  const CoinBigIndex *COIN_RESTRICT columnStart = info.start;
+  const int *COIN_RESTRICT columnLength = info.length;
+  const int *COIN_RESTRICT column = info.column;
+  const double *COIN_RESTRICT element = info.element;
+  const double *COIN_RESTRICT solution = info.solution;
+  const double *COIN_RESTRICT scale = info.scale;
+  double *COIN_RESTRICT product = info.product;
+  for (int iColumn = info.first; iColumn < info.last; iColumn++) {
+    double valueI = solution[iColumn];
+    double scaleI = scale ? scale[iColumn] : 1.0;
+    CoinBigIndex start = columnStart[iColumn];
+    CoinBigIndex end = start + columnLength[iColumn];
+    double sum = 0.0;
+    if (info.fullMatrix) {
+      if (!scale) {
+        for (CoinBigIndex j = start; j < end; j++)
+          sum += solution[column[j]] * element[j];
+      } else {
+        for (CoinBigIndex j = start; j < end; j++) {
+          int jColumn = column[j];
+          sum += solution[jColumn] * element[j] * scale[jColumn];
+        }
+      }
+      product[iColumn] += sum * scaleI;
+    } else {
+      double scatter = valueI * scaleI;
+      double diagonal = 0.0;
+      for (CoinBigIndex j = start; j < end; j++) {
+        int jColumn = column[j];
+        double value = scale ? element[j] * scale[jColumn] : element[j];
+        sum += solution[jColumn] * value;
+        product[jColumn] += scatter * value;
+        if (jColumn == iColumn)
+          diagonal += value;
+      }
+      // diagonal went in twice
+      product[iColumn] += (sum - valueI * diagonal) * scaleI;
+    }
+  }
+}
+/* Sets product (numberExtended long) to Q*solution where Q has
+   element (i,j) multiplied by scale[i]*scale[j] if scale.
+   With threads columns are split so each block has same number of
+   elements - for half matrix each block has its own product */
+static void
+quadraticTimes(const CoinPackedMatrix *quadratic, bool fullMatrix,
+  int numberColumns, int numberExtended, const double *solution,
+  const double *scale, double *product)
+{
+  clpQuadraticInfo info;
+  info.start = quadratic->getVectorStarts();
+  info.length = quadratic->getVectorLengths();
+  info.column = quadratic->getIndices();
+  info.element = quadratic->getElements();
+  info.solution = solution;
+  info.scale = scale;
+  info.product = product;
+  info.first = 0;
+  info.last = numberColumns;
+  info.fullMatrix = fullMatrix;
+  CoinZeroN(product, numberExtended);
+#if ABOCA_LITE
+  int numberThreads = abcState();
+  CoinBigIndex numberElements = quadratic->getNumElements();
+  if (numberThreads > 1 && numberElements > CLP_QUADRATIC_PARALLEL) {
+    clpQuadraticInfo infos[ABOCA_LITE];
+    double *work = NULL;
+    if (!fullMatrix) {
+      work = new double[(numberThreads - 1) * numberExtended];
+      CoinZeroN(work, (numberThreads - 1) * numberExtended);
+    }
+    CoinBigIndex chunk = numberElements / numberThreads + 1;
+    CoinBigIndex done = 0;
+    int iColumn = 0;
+    for (int i = 0; i < numberThreads; i++) {
+      infos[i] = info;
+      infos[i].first = iColumn;
+      while (iColumn < numberColumns && done < (i + 1) * chunk)
+        done += info.length[iColumn++];
+      if (i == numberThreads - 1)
+        iColumn = numberColumns;
+      infos[i].last = iColumn;
+      if (i && work)
+        infos[i].product = work + (i - 1) * numberExtended;
+    }
+    for (int i = 0; i < numberThreads; i++) {
+      cilk_spawn quadraticTimesBit(infos[i]);
+    }
+    cilk_sync;
+    if (work) {
+      // add in same order whatever threads did
+      for (int i = 1; i < numberThreads; i++) {
+        const double *other = work + (i - 1) * numberExtended;
+        for (int j = 0; j < numberExtended; j++)
+          product[j] += other[j];
+      }
+      delete[] work;
+    }
+    return;
+  }
+#endif
+  quadraticTimesBit(info);
+}
 //#############################################################################
 // Constructors / Destructor / Assignment
 //#############################################################################
@@ -25,6 +154,12 @@ ClpQuadraticObjective::ClpQuadraticObjective()
   numberExtendedColumns_ = 0;
   activated_ = 0;
   fullMatrix_ = false;
+  lastProduct_ = NULL;
+  lastSolution_ = NULL;
+  lastScale_ = NULL;
+  lastElements_ = NULL;
+  rowCopy_ = NULL;
+  numberUpdates_ = 0;
 }
 
 //-------------------------------------------------------------------
@@ -59,6 +194,12 @@ ClpQuadraticObjective::ClpQuadraticObjective(const double *objective,
   gradient_ = NULL;
   activated_ = 1;
   fullMatrix_ = false;
+  lastProduct_ = NULL;
+  lastSolution_ = NULL;
+  lastScale_ = NULL;
+  lastElements_ = NULL;
+  rowCopy_ = NULL;
+  numberUpdates_ = 0;
 }
 
 //-------------------------------------------------------------------
@@ -71,6 +212,12 @@ ClpQuadraticObjective::ClpQuadraticObjective(const ClpQuadraticObjective &rhs,
   numberColumns_ = rhs.numberColumns_;
   numberExtendedColumns_ = rhs.numberExtendedColumns_;
   fullMatrix_ = rhs.fullMatrix_;
+  lastProduct_ = NULL;
+  lastSolution_ = NULL;
+  lastScale_ = NULL;
+  lastElements_ = NULL;
+  rowCopy_ = NULL;
+  numberUpdates_ = 0;
   if (rhs.objective_) {
     objective_ = new double[numberExtendedColumns_];
     CoinMemcpyN(rhs.objective_, numberExtendedColumns_, objective_);
@@ -198,6 +345,12 @@ ClpQuadraticObjective::ClpQuadraticObjective(const ClpQuadraticObjective &rhs,
   : ClpObjective(rhs)
 {
   fullMatrix_ = rhs.fullMatrix_;
+  lastProduct_ = NULL;
+  lastSolution_ = NULL;
+  lastScale_ = NULL;
+  lastElements_ = NULL;
+  rowCopy_ = NULL;
+  numberUpdates_ = 0;
   objective_ = NULL;
   int extra = rhs.numberExtendedColumns_ - rhs.numberColumns_;
   numberColumns_ = 0;
@@ -248,6 +401,7 @@ ClpQuadraticObjective::~ClpQuadraticObjective()
   delete[] objective_;
   delete[] gradient_;
   delete quadraticObjective_;
+  clearProduct();
 }
 
 //----------------------------------------------------------------
@@ -257,6 +411,7 @@ ClpQuadraticObjective &
 ClpQuadraticObjective::operator=(const ClpQuadraticObjective &rhs)
 {
   if (this != &rhs) {
+    clearProduct();
     fullMatrix_ = rhs.fullMatrix_;
     delete quadraticObjective_;
     quadraticObjective_ = NULL;
@@ -311,10 +466,6 @@ ClpQuadraticObjective::gradient(const ClpSimplex *model,
       if (refresh || !gradient_) {
         if (!gradient_)
           gradient_ = new double[numberExtendedColumns_];
-        const int *columnQuadratic = quadraticObjective_->getIndices();
-        const CoinBigIndex *columnQuadraticStart = quadraticObjective_->getVectorStarts();
-        const int *columnQuadraticLength = quadraticObjective_->getVectorLengths();
-        const double *quadraticElement = quadraticObjective_->getElements();
         offset = 0.0;
         // use current linear cost region
         if (includeLinear == 1)
@@ -324,56 +475,13 @@ ClpQuadraticObjective::gradient(const ClpSimplex *model,
         else
           memset(gradient_, 0, numberExtendedColumns_ * sizeof(double));
         if (activated_) {
-          if (!fullMatrix_) {
-            int iColumn;
-            for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-              double valueI = solution[iColumn];
-              CoinBigIndex j;
-              for (j = columnQuadraticStart[iColumn];
-                   j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-                int jColumn = columnQuadratic[j];
-                double valueJ = solution[jColumn];
-                double elementValue = quadraticElement[j];
-                if (iColumn != jColumn) {
-                  offset += valueI * valueJ * elementValue;
-                  //if (fabs(valueI*valueJ*elementValue)>1.0e-12)
-                  //printf("%d %d %g %g %g -> %g\n",
-                  //       iColumn,jColumn,valueI,valueJ,elementValue,
-                  //       valueI*valueJ*elementValue);
-                  double gradientI = valueJ * elementValue;
-                  double gradientJ = valueI * elementValue;
-                  gradient_[iColumn] += gradientI;
-                  gradient_[jColumn] += gradientJ;
-                } else {
-                  offset += 0.5 * valueI * valueI * elementValue;
-                  //if (fabs(valueI*valueI*elementValue)>1.0e-12)
-                  //printf("XX %d %g %g -> %g\n",
-                  //       iColumn,valueI,elementValue,
-                  //       0.5*valueI*valueI*elementValue);
-                  double gradientI = valueI * elementValue;
-                  gradient_[iColumn] += gradientI;
-                }
-              }
-            }
-          } else {
-            // full matrix
-            int iColumn;
-            offset *= 2.0;
-            for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-              CoinBigIndex j;
-              double value = 0.0;
-              double current = gradient_[iColumn];
-              for (j = columnQuadraticStart[iColumn];
-                   j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-                int jColumn = columnQuadratic[j];
-                double valueJ = solution[jColumn] * quadraticElement[j];
-                value += valueJ;
-              }
-              offset += value * solution[iColumn];
-              gradient_[iColumn] = current + value;
-            }
-            offset *= 0.5;
+          quadraticProduct(solution, NULL);
+          for (int iColumn = 0; iColumn < numberExtendedColumns_; iColumn++) {
+            double value = lastProduct_[iColumn];
+            offset += value * solution[iColumn];
+            gradient_[iColumn] += value;
           }
+          offset *= 0.5;
         }
       }
       if (model)
@@ -392,10 +500,6 @@ ClpQuadraticObjective::gradient(const ClpSimplex *model,
       // direction is actually scale out not scale in
       //if (direction)
       //direction = 1.0/direction;
-      const int *columnQuadratic = quadraticObjective_->getIndices();
-      const CoinBigIndex *columnQuadraticStart = quadraticObjective_->getVectorStarts();
-      const int *columnQuadraticLength = quadraticObjective_->getVectorLengths();
-      const double *quadraticElement = quadraticObjective_->getElements();
       int iColumn;
       const double *columnScale = model->columnScale();
       // use current linear cost region (already scaled)
@@ -415,59 +519,14 @@ ClpQuadraticObjective::gradient(const ClpSimplex *model,
       } else {
         memset(gradient_, 0, numberExtendedColumns_ * sizeof(double));
       }
-      if (!columnScale) {
-        if (activated_) {
-          for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-            double valueI = solution[iColumn];
-            CoinBigIndex j;
-            for (j = columnQuadraticStart[iColumn];
-                 j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-              int jColumn = columnQuadratic[j];
-              double valueJ = solution[jColumn];
-              double elementValue = quadraticElement[j];
-              elementValue *= direction;
-              if (iColumn != jColumn) {
-                offset += valueI * valueJ * elementValue;
-                double gradientI = valueJ * elementValue;
-                double gradientJ = valueI * elementValue;
-                gradient_[iColumn] += gradientI;
-                gradient_[jColumn] += gradientJ;
-              } else {
-                offset += 0.5 * valueI * valueI * elementValue;
-                double gradientI = valueI * elementValue;
-                gradient_[iColumn] += gradientI;
-              }
-            }
-          }
-        }
-      } else {
-        // scaling
-        if (activated_) {
-          for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-            double valueI = solution[iColumn];
-            double scaleI = columnScale[iColumn] * direction;
-            CoinBigIndex j;
-            for (j = columnQuadraticStart[iColumn];
-                 j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-              int jColumn = columnQuadratic[j];
-              double valueJ = solution[jColumn];
-              double elementValue = quadraticElement[j];
-              double scaleJ = columnScale[jColumn];
-              elementValue *= scaleI * scaleJ;
-              if (iColumn != jColumn) {
-                offset += valueI * valueJ * elementValue;
-                double gradientI = valueJ * elementValue;
-                double gradientJ = valueI * elementValue;
-                gradient_[iColumn] += gradientI;
-                gradient_[jColumn] += gradientJ;
-              } else {
-                offset += 0.5 * valueI * valueI * elementValue;
-                double gradientI = valueI * elementValue;
-                gradient_[iColumn] += gradientI;
-              }
-            }
-          }
+      if (activated_) {
+        quadraticProduct(solution, columnScale);
+        for (iColumn = 0; iColumn < numberExtendedColumns_; iColumn++) {
+          double value = lastProduct_[iColumn] * direction;
+          offset += value * solution[iColumn];
+          gradient_[iColumn] += value;
         }
+        offset *= 0.5;
       }
     }
     if (model)
@@ -496,6 +555,7 @@ ClpQuadraticObjective::subsetClone(int numberColumns,
 void ClpQuadraticObjective::resize(int newNumberColumns)
 {
   if (numberColumns_ != newNumberColumns) {
+    clearProduct();
     int newExtended = newNumberColumns + (numberExtendedColumns_ - numberColumns_);
     int i;
     double *newArray = new double[newExtended];
@@ -534,6 +594,7 @@ void ClpQuadraticObjective::resize(int newNumberColumns)
 // Delete columns in  objective
 void ClpQuadraticObjective::deleteSome(int numberToDelete, const int *which)
 {
+  clearProduct();
   int newNumberColumns = numberColumns_ - numberToDelete;
   int newExtended = numberExtendedColumns_ - numberToDelete;
   if (objective_) {
@@ -602,6 +663,7 @@ void ClpQuadraticObjective::deleteSome(int numberToDelete, const int *which)
 void ClpQuadraticObjective::loadQuadraticObjective(const int numberColumns, const CoinBigIndex *start,
   const int *column, const double *element, int numberExtended)
 {
+  clearProduct();
   fullMatrix_ = false;
   delete quadraticObjective_;
   quadraticObjective_ = new CoinPackedMatrix(true, numberColumns, numberColumns,
@@ -631,12 +693,14 @@ void ClpQuadraticObjective::loadQuadraticObjective(const int numberColumns, cons
 }
 void ClpQuadraticObjective::loadQuadraticObjective(const CoinPackedMatrix &matrix)
 {
+  clearProduct();
   delete quadraticObjective_;
   quadraticObjective_ = new CoinPackedMatrix(matrix);
 }
 // Get rid of quadratic objective
 void ClpQuadraticObjective::deleteQuadraticObjective()
 {
+  clearProduct();
   delete quadraticObjective_;
   quadraticObjective_ = NULL;
 }
@@ -753,118 +817,35 @@ ClpQuadraticObjective::stepLength(ClpSimplex *model,
   bool scaling = false;
   if ((model->rowScale() || model->objectiveScale() != 1.0 || model->optimizationDirection() != 1.0) && inSolve)
     scaling = true;
-  const int *columnQuadratic = quadraticObjective_->getIndices();
-  const CoinBigIndex *columnQuadraticStart = quadraticObjective_->getVectorStarts();
-  const int *columnQuadraticLength = quadraticObjective_->getVectorLengths();
-  const double *quadraticElement = quadraticObjective_->getElements();
   double a = 0.0;
   double b = delta;
   double c = 0.0;
-  if (!scaling) {
-    if (!fullMatrix_) {
-      int iColumn;
-      for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-        double valueI = solution[iColumn];
-        double changeI = change[iColumn];
-        CoinBigIndex j;
-        for (j = columnQuadraticStart[iColumn];
-             j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-          int jColumn = columnQuadratic[j];
-          double valueJ = solution[jColumn];
-          double changeJ = change[jColumn];
-          double elementValue = quadraticElement[j];
-          if (iColumn != jColumn) {
-            a += changeI * changeJ * elementValue;
-            b += (changeI * valueJ + changeJ * valueI) * elementValue;
-            c += valueI * valueJ * elementValue;
-          } else {
-            a += 0.5 * changeI * changeI * elementValue;
-            b += changeI * valueI * elementValue;
-            c += 0.5 * valueI * valueI * elementValue;
-          }
-        }
-      }
-    } else {
-      // full matrix stored
-      int iColumn;
-      for (iColumn = 0; iColumn < numberColumns_; iColumn++) {
-        double valueI = solution[iColumn];
-        double changeI = change[iColumn];
-        CoinBigIndex j;
-        for (j = columnQuadraticStart[iColumn];
-             j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-          int jColumn = columnQuadratic[j];
-          double valueJ = solution[jColumn];
-          double changeJ = change[jColumn];
-          double elementValue = quadraticElement[j];
-          valueJ *= elementValue;
-          a += changeI * changeJ * elementValue;
-          b += changeI * valueJ;
-          c += valueI * valueJ;
-        }
-      }
-      a *= 0.5;
-      c *= 0.5;
-    }
-  } else {
-    // scaling
+  const double *columnScale = NULL;
+  double direction = 1.0;
+  if (scaling) {
     // for now only if half
     assert(!fullMatrix_);
-    const double *columnScale = model->columnScale();
-    double direction = model->optimizationDirection() * model->objectiveScale();
+    columnScale = model->columnScale();
+    direction = model->optimizationDirection() * model->objectiveScale();
     // direction is actually scale out not scale in
     if (direction)
       direction = 1.0 / direction;
-    if (!columnScale) {
-      for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
-        double valueI = solution[iColumn];
-        double changeI = change[iColumn];
-        CoinBigIndex j;
-        for (j = columnQuadraticStart[iColumn];
-             j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-          int jColumn = columnQuadratic[j];
-          double valueJ = solution[jColumn];
-          double changeJ = change[jColumn];
-          double elementValue = quadraticElement[j];
-          elementValue *= direction;
-          if (iColumn != jColumn) {
-            a += changeI * changeJ * elementValue;
-            b += (changeI * valueJ + changeJ * valueI) * elementValue;
-            c += valueI * valueJ * elementValue;
-          } else {
-            a += 0.5 * changeI * changeI * elementValue;
-            b += changeI * valueI * elementValue;
-            c += 0.5 * valueI * valueI * elementValue;
-          }
-        }
-      }
-    } else {
-      // scaling
-      for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
-        double valueI = solution[iColumn];
-        double changeI = change[iColumn];
-        double scaleI = columnScale[iColumn] * direction;
-        CoinBigIndex j;
-        for (j = columnQuadraticStart[iColumn];
-             j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
-          int jColumn = columnQuadratic[j];
-          double valueJ = solution[jColumn];
-          double changeJ = change[jColumn];
-          double elementValue = quadraticElement[j];
-          elementValue *= scaleI * columnScale[jColumn];
-          if (iColumn != jColumn) {
-            a += changeI * changeJ * elementValue;
-            b += (changeI * valueJ + changeJ * valueI) * elementValue;
-            c += valueI * valueJ * elementValue;
-          } else {
-            a += 0.5 * changeI * changeI * elementValue;
-            b += changeI * valueI * elementValue;
-            c += 0.5 * valueI * valueI * elementValue;
-          }
-        }
-      }
-    }
   }
+  // Q*change
+  double *product = new double[numberExtendedColumns_];
+  quadraticTimes(quadraticObjective_, fullMatrix_, numberColumns_,
+    numberExtendedColumns_, change, columnScale, product);
+  // Q*solution - probably there from gradient
+  quadraticProduct(solution, columnScale);
+  for (int iColumn = 0; iColumn < numberExtendedColumns_; iColumn++) {
+    double changeI = change[iColumn];
+    a += changeI * product[iColumn];
+    b += changeI * lastProduct_[iColumn] * direction;
+    c += solution[iColumn] * lastProduct_[iColumn];
+  }
+  delete[] product;
+  a *= 0.5 * direction;
+  c *= 0.5 * direction;
   double theta;
   //printf("Current cost %g\n",c+linearCost);
   currentObj = c + linearCost;
@@ -1003,6 +984,7 @@ ClpQuadraticObjective::objectiveValue(const ClpSimplex *model, const double *sol
 // Scale objective
 void ClpQuadraticObjective::reallyScale(const double *columnScale)
 {
+  clearProduct();
   const int *columnQuadratic = quadraticObjective_->getIndices();
   const CoinBigIndex *columnQuadraticStart = quadraticObjective_->getVectorStarts();
   const int *columnQuadraticLength = quadraticObjective_->getVectorLengths();
@@ -1043,6 +1025,111 @@ int ClpQuadraticObjective::markNonlinear(char *which)
   }
   return numberNonLinearColumns;
 }
+/* Sets lastProduct_ to Q*solution with Q scaled by scale (may be NULL).
+   If few values changed since last time then just updates */
+void ClpQuadraticObjective::quadraticProduct(const double *solution,
+  const double *scale)
+{
+  const double *element = quadraticObjective_->getElements();
+  bool update = lastProduct_ && element == lastElements_
+    && (scale != NULL) == (lastScale_ != NULL)
+    && numberUpdates_ < CLP_QUADRATIC_REFRESH
+    && numberExtendedColumns_ == numberColumns_;
+  int numberChanged = 0;
+  if (update) {
+    int maximumChanged = numberColumns_ >> 3;
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      if (solution[iColumn] != lastSolution_[iColumn]) {
+        numberChanged++;
+        if (numberChanged > maximumChanged) {
+          update = false;
+          break;
+        }
+      }
+      if (scale && scale[iColumn] != lastScale_[iColumn]) {
+        update = false;
+        break;
+      }
+    }
+  }
+  if (!update) {
+    // row copy may also have old elements
+    if (element != lastElements_) {
+      delete rowCopy_;
+      rowCopy_ = NULL;
+    }
+    if (!lastProduct_) {
+      lastProduct_ = new double[numberExtendedColumns_];
+      lastSolution_ = new double[numberExtendedColumns_];
+    }
+    delete[] lastScale_;
+    lastScale_ = scale ? CoinCopyOfArray(scale, numberColumns_) : NULL;
+    lastElements_ = element;
+    numberUpdates_ = 0;
+    CoinMemcpyN(solution, numberExtendedColumns_, lastSolution_);
+    quadraticTimes(quadraticObjective_, fullMatrix_, numberColumns_,
+      numberExtendedColumns_, solution, scale, lastProduct_);
+  } else if (numberChanged) {
+    numberUpdates_++;
+    const int *columnQuadratic = quadraticObjective_->getIndices();
+    const CoinBigIndex *columnQuadraticStart = quadraticObjective_->getVectorStarts();
+    const int *columnQuadraticLength = quadraticObjective_->getVectorLengths();
+    if (!fullMatrix_ && !rowCopy_) {
+      // need rest of each column of Q
+      rowCopy_ = new CoinPackedMatrix();
+      rowCopy_->reverseOrderedCopyOf(*quadraticObjective_);
+    }
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      double change = solution[iColumn] - lastSolution_[iColumn];
+      if (!change)
+        continue;
+      lastSolution_[iColumn] = solution[iColumn];
+      if (scale)
+        change *= scale[iColumn];
+      CoinBigIndex j;
+      for (j = columnQuadraticStart[iColumn];
+           j < columnQuadraticStart[iColumn] + columnQuadraticLength[iColumn]; j++) {
+        int jColumn = columnQuadratic[j];
+        double value = scale ? element[j] * scale[jColumn] : element[j];
+        lastProduct_[jColumn] += change * value;
+      }
+      if (!fullMatrix_ && iColumn < rowCopy_->getMajorDim()) {
+        // elements in other columns with row iColumn
+        const int *rowQuadratic = rowCopy_->getIndices();
+        const CoinBigIndex *rowQuadraticStart = rowCopy_->getVectorStarts();
+        const int *rowQuadraticLength = rowCopy_->getVectorLengths();
+        const double *rowElement = rowCopy_->getElements();
+        for (j = rowQuadraticStart[iColumn];
+             j < rowQuadraticStart[iColumn] + rowQuadraticLength[iColumn]; j++) {
+          int jColumn = rowQuadratic[j];
+          if (jColumn != iColumn) {
+            double value = scale ? rowElement[j] * scale[jColumn] : rowElement[j];
+            lastProduct_[jColumn] += change * value;
+          }
+        }
+      }
+    }
+  }
+}
+// Say quadratic elements changed in place so Q*x is computed from scratch
+void ClpQuadraticObjective::markChanged()
+{
+  clearProduct();
+}
+// Forget lastProduct_ (matrix or sizes changed)
+void ClpQuadraticObjective::clearProduct()
+{
+  delete[] lastProduct_;
+  lastProduct_ = NULL;
+  delete[] lastSolution_;
+  lastSolution_ = NULL;
+  delete[] lastScale_;
+  lastScale_ = NULL;
+  lastElements_ = NULL;
+  delete rowCopy_;
+  rowCopy_ = NULL;
+  numberUpdates_ = 0;
+}
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
 */
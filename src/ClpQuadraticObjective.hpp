@@ -108,11 +108,15 @@ public:
   //@}
   ///@name Gets and sets
   //@{
-  /// Quadratic objective
+  /** Quadratic objective.  If elements are changed in place through
+      this (getMutableElements, modifyCoefficient etc) then markChanged()
+      must be called before the next gradient or step length */
   inline CoinPackedMatrix *quadraticObjective() const
   {
     return quadraticObjective_;
   }
+  /// Say quadratic elements changed in place so Q*x is computed from scratch
+  void markChanged();
   /// Linear objective
   inline double *linearObjective() const
   {
@@ -138,6 +142,14 @@ public:
   //---------------------------------------------------------------------------
 
 private:
+  ///@name Private methods
+  //@{
+  /** Sets lastProduct_ to Q*solution with Q scaled by scale (may be NULL).
+      If few values changed since last time then just updates */
+  void quadraticProduct(const double *solution, const double *scale);
+  /// Forget lastProduct_ (matrix or sizes changed)
+  void clearProduct();
+  //@}
   ///@name Private member data
   /// Quadratic objective
   CoinPackedMatrix *quadraticObjective_;
@@ -151,6 +163,18 @@ private:
   int numberExtendedColumns_;
   /// True if full symmetric matrix, false if half
   bool fullMatrix_;
+  /// Q*x (scaled) at lastSolution_ - so gradient can be updated
+  double *lastProduct_;
+  /// Solution lastProduct_ is for
+  double *lastSolution_;
+  /// Column scale lastProduct_ is for (NULL if none)
+  double *lastScale_;
+  /// Elements lastProduct_ is for (to spot new matrix)
+  const double *lastElements_;
+  /// Row copy of half matrix for updating lastProduct_
+  CoinPackedMatrix *rowCopy_;
+  /// Number of updates since lastProduct_ computed from scratch
+  int numberUpdates_;
   //@}
 };
 
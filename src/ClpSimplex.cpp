@@ -14,6 +14,10 @@
 #endif
 #include "CoinHelperFunctions.hpp"
 #include "CoinFloatEqual.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 #include "ClpSimplex.hpp"
 #include "ClpFactorization.hpp"
 #include "ClpPackedMatrix.hpp"
@@ -27,6 +31,7 @@
 #include "ClpNonLinearCost.hpp"
 #include "ClpMessage.hpp"
 #include "ClpEventHandler.hpp"
+#include "ClpIterationTrace.hpp"
 #include "ClpLinearObjective.hpp"
 #include "ClpHelperFunctions.hpp"
 #include "CoinModel.hpp"
@@ -126,6 +131,13 @@ ClpSimplex::ClpSimplex(bool emptyMessages)
   , automaticScale_(0)
   , maximumPerturbationSize_(0)
   , perturbationArray_(NULL)
+  , savedRim_(NULL)
+  , savedRimSize_(0)
+  , numberRimChanged_(0)
+  , maximumRimChanged_(0)
+  , numberIncrementalRims_(0)
+  , profile_(NULL)
+  , iterationTrace_(NULL)
   , baseModel_(NULL)
 #ifdef ABC_INHERIT
   , abcSimplex_(NULL)
@@ -249,6 +261,13 @@ ClpSimplex::ClpSimplex(const ClpModel *rhs,
   , automaticScale_(0)
   , maximumPerturbationSize_(0)
   , perturbationArray_(NULL)
+  , savedRim_(NULL)
+  , savedRimSize_(0)
+  , numberRimChanged_(0)
+  , maximumRimChanged_(0)
+  , numberIncrementalRims_(0)
+  , profile_(NULL)
+  , iterationTrace_(NULL)
   , baseModel_(NULL)
 #ifdef ABC_INHERIT
   , abcSimplex_(NULL)
@@ -405,6 +424,13 @@ ClpSimplex::ClpSimplex(const ClpSimplex *rhs,
   , automaticScale_(0)
   , maximumPerturbationSize_(0)
   , perturbationArray_(NULL)
+  , savedRim_(NULL)
+  , savedRimSize_(0)
+  , numberRimChanged_(0)
+  , maximumRimChanged_(0)
+  , numberIncrementalRims_(0)
+  , profile_(NULL)
+  , iterationTrace_(NULL)
   , baseModel_(NULL)
 #ifdef ABC_INHERIT
   , abcSimplex_(NULL)
@@ -563,7 +589,7 @@ int ClpSimplex::gutsOfSolution(double *givenDuals,
   const double *givenPrimals,
   bool valuesPass)
 {
-
+  ClpProfileTimer timer(profile_, ClpProfileGutsOfSolution);
   // if values pass, save values of basic variables
   double *save = NULL;
   double oldValue = 0.0;
@@ -2011,7 +2037,13 @@ int ClpSimplex::internalFactorize(int solveType)
 	   numberOutside,sumOutside,numberOutsideLarge,
 	   numberInside,sumInside,numberInsideLarge);
 #endif
-  int status = factorization_->factorize(this, solveType, valuesPass);
+  // factorization may have been replaced so pass profile on each time
+  factorization_->setProfile(profile_);
+  int status;
+  {
+    ClpProfileTimer timer(profile_, ClpProfileFactorize);
+    status = factorization_->factorize(this, solveType, valuesPass);
+  }
   if (status) {
     handler_->message(CLP_SIMPLEX_BADFACTOR, messages_)
       << status
@@ -2467,6 +2499,13 @@ ClpSimplex::ClpSimplex(const ClpSimplex &rhs, int scalingMode)
   , automaticScale_(0)
   , maximumPerturbationSize_(0)
   , perturbationArray_(NULL)
+  , savedRim_(NULL)
+  , savedRimSize_(0)
+  , numberRimChanged_(0)
+  , maximumRimChanged_(0)
+  , numberIncrementalRims_(0)
+  , profile_(NULL)
+  , iterationTrace_(NULL)
   , baseModel_(NULL)
 #ifdef ABC_INHERIT
   , abcSimplex_(NULL)
@@ -2576,6 +2615,13 @@ ClpSimplex::ClpSimplex(const ClpModel &rhs, int scalingMode)
   , automaticScale_(0)
   , maximumPerturbationSize_(0)
   , perturbationArray_(NULL)
+  , savedRim_(NULL)
+  , savedRimSize_(0)
+  , numberRimChanged_(0)
+  , maximumRimChanged_(0)
+  , numberIncrementalRims_(0)
+  , profile_(NULL)
+  , iterationTrace_(NULL)
   , baseModel_(NULL)
 #ifdef ABC_INHERIT
   , abcSimplex_(NULL)
@@ -2767,6 +2813,22 @@ void ClpSimplex::gutsOfCopy(const ClpSimplex &rhs)
     maximumPerturbationSize_ = 0;
     perturbationArray_ = NULL;
   }
+  // work arrays will be redone completely
+  savedRim_ = NULL;
+  savedRimSize_ = 0;
+  numberRimChanged_ = 0;
+  maximumRimChanged_ = 0;
+  numberIncrementalRims_ = 0;
+  if (rhs.profile_) {
+    profile_ = new ClpProfile;
+    memcpy(profile_, rhs.profile_, sizeof(ClpProfile));
+  } else {
+    profile_ = NULL;
+  }
+  if (factorization_)
+    factorization_->setProfile(profile_);
+  // trace has single writer
+  iterationTrace_ = NULL;
   if (rhs.baseModel_) {
     baseModel_ = new ClpSimplex(*rhs.baseModel_);
   } else {
@@ -2851,6 +2913,13 @@ void ClpSimplex::gutsOfDelete(int type)
     delete[] perturbationArray_;
     perturbationArray_ = NULL;
     maximumPerturbationSize_ = 0;
+    delete[] savedRim_;
+    savedRim_ = NULL;
+    savedRimSize_ = 0;
+    numberRimChanged_ = 0;
+    maximumRimChanged_ = 0;
+    delete profile_;
+    profile_ = NULL;
   } else {
     // delete any size information in methods
     if (type > 1) {
@@ -3376,6 +3445,7 @@ void ClpSimplex::unpackPacked(CoinIndexedVector *rowArray, int sequence)
 //static int scale_times[]={0,0,0,0};
 bool ClpSimplex::createRim(int what, bool makeRowCopy, int startFinishOptions)
 {
+  ClpProfileTimer timer(profile_, ClpProfileCreateRim);
   bool goodMatrix = true;
   int saveLevel = handler_->logLevel();
   spareIntArray_[0] = 0;
@@ -3755,7 +3825,44 @@ bool ClpSimplex::createRim(int what, bool makeRowCopy, int startFinishOptions)
     rowUpperWork_ = upper_ + numberColumns_;
     columnUpperWork_ = upper_;
   }
-  if ((what & 4) != 0) {
+  /* If permanent arrays and nothing big changed then saved costs
+     and bounds are good except for entries whose model values differ
+     from those saved - whether changed by set methods or written
+     straight into objective(), columnLower() etc */
+  bool incremental = false;
+  if (what == 63) {
+    if (oldMatrix && !newArrays && (specialOptions_ & 65536) != 0
+      && savedRim_ && savedRimSize_ >= 3 * numberTotal
+      && numberRimChanged_ <= maximumRimChanged_
+      && (whatsChanged_ & (16 + 32 + 64 + 128 + 256)) == 16 + 32 + 64 + 128 + 256
+      && !numberExtraRows_ && !automaticScale_ && objective_->type() < 2) {
+      incremental = true;
+      numberIncrementalRims_++;
+      int save = maximumColumns_ + maximumRows_;
+      CoinMemcpyN(cost_ + save, numberTotal, cost_);
+      CoinMemcpyN(lower_ + save, numberTotal, lower_);
+      CoinMemcpyN(upper_ + save, numberTotal, upper_);
+      const double *obj = objective();
+      const double *savedCost = savedRim_;
+      const double *savedLower = savedRim_ + numberTotal;
+      const double *savedUpper = savedLower + numberTotal;
+      for (i = 0; i < numberColumns_; i++) {
+        if (obj[i] != savedCost[i] || columnLower_[i] != savedLower[i]
+          || columnUpper_[i] != savedUpper[i])
+          createRimEntry(i);
+      }
+      for (i = 0; i < numberRows_; i++) {
+        int iSequence = i + numberColumns_;
+        double value = rowObjective_ ? rowObjective_[i] : 0.0;
+        if (value != savedCost[iSequence] || rowLower_[i] != savedLower[iSequence]
+          || rowUpper_[i] != savedUpper[iSequence])
+          createRimEntry(iSequence);
+      }
+    }
+    // saved arrays not valid until end
+    numberRimChanged_ = maximumRimChanged_ + 1;
+  }
+  if ((what & 4) != 0 && !incremental) {
     double direction = optimizationDirection_ * objectiveScale_;
     const double *obj = objective();
     const double *rowScale = rowScale_;
@@ -3788,7 +3895,7 @@ bool ClpSimplex::createRim(int what, bool makeRowCopy, int startFinishOptions)
       }
     }
   }
-  if ((what & 1) != 0) {
+  if ((what & 1) != 0 && !incremental) {
     const double *rowScale = rowScale_;
     // clean up any mismatches on infinity
     // and fix any variables with tiny gaps
@@ -4007,34 +4114,36 @@ bool ClpSimplex::createRim(int what, bool makeRowCopy, int startFinishOptions)
         double scaleFactor = columnScale_[i];
         double multiplier = rhsScale_ * inverseScale[i];
         scaleFactor *= direction;
-        objectiveWork_[i] = obj[i] * scaleFactor;
         reducedCostWork_[i] = reducedCost_[i] * scaleFactor;
-        double lowerValue = columnLower_[i];
-        double upperValue = columnUpper_[i];
-        if (lowerValue > -1.0e20) {
-          columnLowerWork_[i] = lowerValue * multiplier;
-          if (upperValue >= 1.0e20) {
-            columnUpperWork_[i] = COIN_DBL_MAX;
-          } else {
-            columnUpperWork_[i] = upperValue * multiplier;
-            if (fabs(columnUpperWork_[i] - columnLowerWork_[i]) <= primalTolerance) {
-              if (columnLowerWork_[i] >= 0.0) {
-                columnUpperWork_[i] = columnLowerWork_[i];
-              } else if (columnUpperWork_[i] <= 0.0) {
-                columnLowerWork_[i] = columnUpperWork_[i];
-              } else {
-                columnUpperWork_[i] = 0.0;
-                columnLowerWork_[i] = 0.0;
+        if (!incremental) {
+          objectiveWork_[i] = obj[i] * scaleFactor;
+          double lowerValue = columnLower_[i];
+          double upperValue = columnUpper_[i];
+          if (lowerValue > -1.0e20) {
+            columnLowerWork_[i] = lowerValue * multiplier;
+            if (upperValue >= 1.0e20) {
+              columnUpperWork_[i] = COIN_DBL_MAX;
+            } else {
+              columnUpperWork_[i] = upperValue * multiplier;
+              if (fabs(columnUpperWork_[i] - columnLowerWork_[i]) <= primalTolerance) {
+                if (columnLowerWork_[i] >= 0.0) {
+                  columnUpperWork_[i] = columnLowerWork_[i];
+                } else if (columnUpperWork_[i] <= 0.0) {
+                  columnLowerWork_[i] = columnUpperWork_[i];
+                } else {
+                  columnUpperWork_[i] = 0.0;
+                  columnLowerWork_[i] = 0.0;
+                }
               }
             }
+          } else if (upperValue < 1.0e20) {
+            columnLowerWork_[i] = -COIN_DBL_MAX;
+            columnUpperWork_[i] = upperValue * multiplier;
+          } else {
+            // free
+            columnLowerWork_[i] = -COIN_DBL_MAX;
+            columnUpperWork_[i] = COIN_DBL_MAX;
           }
-        } else if (upperValue < 1.0e20) {
-          columnLowerWork_[i] = -COIN_DBL_MAX;
-          columnUpperWork_[i] = upperValue * multiplier;
-        } else {
-          // free
-          columnLowerWork_[i] = -COIN_DBL_MAX;
-          columnUpperWork_[i] = COIN_DBL_MAX;
         }
         double value = columnActivity_[i] * multiplier;
         if (fabs(value) > 1.0e20) {
@@ -4263,6 +4372,29 @@ bool ClpSimplex::createRim(int what, bool makeRowCopy, int startFinishOptions)
     CoinMemcpyN(upper_, numberTotal, upper_ + save);
     CoinMemcpyN(dj_, numberTotal, dj_ + save);
     CoinMemcpyN(solution_, numberTotal, solution_ + save);
+    if (what == 63) {
+      // start tracking changes to costs and bounds
+      maximumRimChanged_ = numberTotal / 8 + 16;
+      if (3 * numberTotal > savedRimSize_) {
+        delete[] savedRim_;
+        savedRimSize_ = 3 * numberTotal;
+        savedRim_ = new double[savedRimSize_];
+      }
+      // remember model values so direct changes can be found
+      double *savedCost = savedRim_;
+      double *savedLower = savedRim_ + numberTotal;
+      double *savedUpper = savedLower + numberTotal;
+      CoinMemcpyN(objective(), numberColumns_, savedCost);
+      if (rowObjective_)
+        CoinMemcpyN(rowObjective_, numberRows_, savedCost + numberColumns_);
+      else
+        CoinZeroN(savedCost + numberColumns_, numberRows_);
+      CoinMemcpyN(columnLower_, numberColumns_, savedLower);
+      CoinMemcpyN(rowLower_, numberRows_, savedLower + numberColumns_);
+      CoinMemcpyN(columnUpper_, numberColumns_, savedUpper);
+      CoinMemcpyN(rowUpper_, numberRows_, savedUpper + numberColumns_);
+      numberRimChanged_ = 0;
+    }
     if (rowScale_ && !savedRowScale_) {
       double *temp;
       temp = new double[4 * maximumRows_];
@@ -4554,6 +4686,68 @@ void ClpSimplex::createRim5(bool initial)
   createRim4(initial);
   createRim1(initial);
 }
+// Recomputes scaled cost and bounds of one sequence from model arrays
+void ClpSimplex::createRimEntry(int iSequence)
+{
+  double direction = optimizationDirection_ * objectiveScale_;
+  double multiplier;
+  double lowerValue;
+  double upperValue;
+  if (iSequence < numberColumns_) {
+    const double *obj = objective();
+    if (rowScale_) {
+      multiplier = rhsScale_ * inverseColumnScale_[iSequence];
+      cost_[iSequence] = obj[iSequence] * (columnScale_[iSequence] * direction);
+    } else {
+      multiplier = rhsScale_;
+      cost_[iSequence] = obj[iSequence] * direction;
+    }
+    lowerValue = columnLower_[iSequence];
+    upperValue = columnUpper_[iSequence];
+  } else {
+    int iRow = iSequence - numberColumns_;
+    double value = 0.0;
+    if (rowScale_) {
+      multiplier = rhsScale_ * rowScale_[iRow];
+      if (rowObjective_)
+        value = rowObjective_[iRow] * direction / rowScale_[iRow];
+    } else {
+      multiplier = rhsScale_;
+      if (rowObjective_)
+        value = rowObjective_[iRow] * direction;
+    }
+    cost_[iSequence] = value;
+    lowerValue = rowLower_[iRow];
+    upperValue = rowUpper_[iRow];
+  }
+  // same cleaning as createRim
+  double primalTolerance = dblParam_[ClpPrimalTolerance];
+  if (lowerValue > -1.0e20) {
+    lower_[iSequence] = lowerValue * multiplier;
+    if (upperValue >= 1.0e20) {
+      upper_[iSequence] = COIN_DBL_MAX;
+    } else {
+      upper_[iSequence] = upperValue * multiplier;
+      if (fabs(upper_[iSequence] - lower_[iSequence]) <= primalTolerance) {
+        if (lower_[iSequence] >= 0.0) {
+          upper_[iSequence] = lower_[iSequence];
+        } else if (upper_[iSequence] <= 0.0) {
+          lower_[iSequence] = upper_[iSequence];
+        } else {
+          upper_[iSequence] = 0.0;
+          lower_[iSequence] = 0.0;
+        }
+      }
+    }
+  } else if (upperValue < 1.0e20) {
+    lower_[iSequence] = -COIN_DBL_MAX;
+    upper_[iSequence] = upperValue * multiplier;
+  } else {
+    // free
+    lower_[iSequence] = -COIN_DBL_MAX;
+    upper_[iSequence] = COIN_DBL_MAX;
+  }
+}
 void ClpSimplex::deleteRim(int getRidOfFactorizationData)
 {
 #ifdef CLP_USER_DRIVEN
@@ -4862,6 +5056,7 @@ void ClpSimplex::setFactorization(ClpFactorization &factorization)
   else
     factorization_ = new ClpFactorization(factorization,
       numberRows_);
+  factorization_->setProfile(profile_);
 }
 
 // Swaps factorization
@@ -4876,6 +5071,7 @@ ClpSimplex::swapFactorization(ClpFactorization *factorization)
 void ClpSimplex::copyFactorization(ClpFactorization &factorization)
 {
   *factorization_ = factorization;
+  factorization_->setProfile(profile_);
 }
 /* Perturbation:
    -50 to +50 - perturb by this power of ten (-6 sounds good)
@@ -7655,6 +7851,17 @@ void ClpSimplex::loadProblem(const int numcols, const int numrows,
     rowObjective);
   createStatus();
 }
+// Takes over ownership of arrays and creates status
+int ClpSimplex::assignProblem(int numcols, int numrows,
+  CoinBigIndex *&start, int *&index, double *&value,
+  double *&collb, double *&colub, double *&obj,
+  double *&rowlb, double *&rowub, int checkType)
+{
+  int numberDuplicates = ClpModel::assignProblem(numcols, numrows,
+    start, index, value, collb, colub, obj, rowlb, rowub, checkType);
+  createStatus();
+  return numberDuplicates;
+}
 
 #ifndef SLIM_NOIO
 // This loads a model from a coinModel object - returns number of errors
@@ -8190,7 +8397,50 @@ void ClpSimplex::checkUnscaledSolution()
    3 Just throw all free variables in basis
    4 Move zero cost variables to make more primal feasible
    5 Put singletons in basis to make more primal feasible
+   6 Triangular crash - structurals chosen so basis is triangular
 */
+// Above this many columns triangular crash scores columns in parallel
+#ifndef CLP_CRASH_PARALLEL
+#define CLP_CRASH_PARALLEL 20000
+#endif
+/* Scores columns for triangular crash.  Penalty (in spare) is 0 for free,
+   1 for one bound and 2 for boxed plus cost*theta (fixed get COIN_DBL_MAX).
+   Largest absolute element goes in work */
+static void
+crashScoreBit(clpTempInfo &info)
+{
+  const double *COIN_RESTRICT element = info.element;
+  const int *COIN_RESTRICT length = info.which;
+  const CoinBigIndex *COIN_RESTRICT columnStart = info.start;
+  const double *COIN_RESTRICT cost = info.cost;
+  const double *COIN_RESTRICT lower = info.lower;
+  const double *COIN_RESTRICT upper = info.upper;
+  double *COIN_RESTRICT penalty = info.spare;
+  double *COIN_RESTRICT largest = info.work;
+  double costMultiplier = info.theta;
+  int first = info.startColumn;
+  int last = first + info.numberToDo;
+  for (int iColumn = first; iColumn < last; iColumn++) {
+    double lowerBound = lower[iColumn];
+    double upperBound = upper[iColumn];
+    double value;
+    if (lowerBound == upperBound) {
+      value = COIN_DBL_MAX;
+    } else {
+      value = costMultiplier * cost[iColumn];
+      if (lowerBound > -1.0e20)
+        value += 1.0;
+      if (upperBound < 1.0e20)
+        value += 1.0;
+    }
+    penalty[iColumn] = value;
+    double biggest = 0.0;
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + length[iColumn]; j++)
+      biggest = CoinMax(biggest, fabs(element[j]));
+    largest[iColumn] = biggest;
+  }
+}
 int ClpSimplex::crash(double gap, int pivot)
 {
   //CoinAssert(!rowObjective_); // not coded
@@ -8413,6 +8663,98 @@ int ClpSimplex::crash(double gap, int pivot)
 	<< nMove
 	<< CoinMessageEol;
       return 0;
+    } else if (pivot == 6) {
+      /* Triangular crash (as Bixby) - take structurals in order of
+         preference if largest element is in a row no column already
+         taken touches.  Basis then stays triangular */
+      CoinPackedMatrix *columnCopy = matrix();
+      const int *row = columnCopy->getIndices();
+      const CoinBigIndex *columnStart = columnCopy->getVectorStarts();
+      const int *columnLength = columnCopy->getVectorLengths();
+      const double *element = columnCopy->getElements();
+      const double *obj = objective();
+      double *penalty = new double[2 * numberColumns_];
+      double *largest = penalty + numberColumns_;
+      int *which = new int[numberColumns_ + numberRows_];
+      int *rowCount = which + numberColumns_;
+      // keep cost within bound type
+      double largestCost = 0.0;
+      for (int iColumn = 0; iColumn < numberColumns_; iColumn++)
+        largestCost = CoinMax(largestCost, fabs(obj[iColumn]));
+      double costMultiplier = largestCost ? 0.5 * optimizationDirection_ / largestCost : 0.0;
+#if ABOCA_LITE
+      int numberThreads = abcState();
+      if (numberThreads < 2 || numberColumns_ < CLP_CRASH_PARALLEL)
+        numberThreads = 1;
+      clpTempInfo info[ABOCA_LITE];
+#else
+      int numberThreads = 1;
+      clpTempInfo info[1];
+#endif
+      int chunk = (numberColumns_ + numberThreads - 1) / numberThreads;
+      int n = 0;
+      for (int i = 0; i < numberThreads; i++) {
+        info[i].element = element;
+        info[i].which = const_cast< int * >(columnLength);
+        info[i].start = columnStart;
+        info[i].cost = obj;
+        info[i].lower = columnLower_;
+        info[i].upper = columnUpper_;
+        info[i].spare = penalty;
+        info[i].work = largest;
+        info[i].theta = costMultiplier;
+        info[i].startColumn = n;
+        info[i].numberToDo = CoinMin(chunk, numberColumns_ - n);
+        n += chunk;
+      }
+      for (int i = 0; i < numberThreads; i++)
+        cilk_spawn crashScoreBit(info[i]);
+      cilk_sync;
+      int numberCandidates = 0;
+      for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+        if (penalty[iColumn] < COIN_DBL_MAX && largest[iColumn]) {
+          // safe as numberCandidates<=iColumn
+          penalty[numberCandidates] = penalty[iColumn];
+          which[numberCandidates++] = iColumn;
+        }
+      }
+      CoinSort_2(penalty, penalty + numberCandidates, which);
+      CoinZeroN(rowCount, numberRows_);
+      int numberPut = 0;
+      for (int i = 0; i < numberCandidates; i++) {
+        int iColumn = which[i];
+        double biggest = largest[iColumn];
+        int kRow = -1;
+        double best = 0.0;
+        for (CoinBigIndex j = columnStart[iColumn];
+             j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+          int iRow = row[j];
+          double value = fabs(element[j]);
+          // free rows stay basic
+          if (!rowCount[iRow] && value > best && (rowLower_[iRow] > -1.0e20 || rowUpper_[iRow] < 1.0e20)) {
+            kRow = iRow;
+            best = value;
+          }
+        }
+        if (kRow >= 0 && best >= 0.99 * biggest) {
+          numberPut++;
+          setColumnStatus(iColumn, basic);
+          if (fabs(rowLower_[kRow]) < fabs(rowUpper_[kRow]))
+            setRowStatus(kRow, atLowerBound);
+          else
+            setRowStatus(kRow, atUpperBound);
+          for (CoinBigIndex j = columnStart[iColumn];
+               j < columnStart[iColumn] + columnLength[iColumn]; j++)
+            rowCount[row[j]]++;
+        }
+      }
+      delete[] penalty;
+      delete[] which;
+      handler_->message(CLP_CRASH_TRIANGULAR, messages_)
+        << numberPut
+        << numberCandidates
+        << CoinMessageEol;
+      return 0;
     }
     // all slack
     double *dj = new double[numberColumns_];
@@ -10363,7 +10705,8 @@ void ClpSimplex::setObjectiveCoefficient(int elementIndex, double elementValue)
     objective()[elementIndex] = elementValue;
     if ((whatsChanged_ & 1) != 0) {
       // work arrays exist - update as well
-      whatsChanged_ &= ~64;
+      if (!markRimChanged(elementIndex))
+        whatsChanged_ &= ~64;
       double direction = optimizationDirection_ * objectiveScale_;
       if (!rowScale_) {
         objectiveWork_[elementIndex] = direction * elementValue;
@@ -10390,7 +10733,8 @@ void ClpSimplex::setRowLower(int elementIndex, double elementValue)
     rowLower_[elementIndex] = elementValue;
     if ((whatsChanged_ & 1) != 0) {
       // work arrays exist - update as well
-      whatsChanged_ &= ~16;
+      if (!markRimChanged(elementIndex + numberColumns_))
+        whatsChanged_ &= ~16;
       if (rowLower_[elementIndex] == -COIN_DBL_MAX) {
         rowLowerWork_[elementIndex] = -COIN_DBL_MAX;
       } else if (!rowScale_) {
@@ -10419,7 +10763,8 @@ void ClpSimplex::setRowUpper(int elementIndex, double elementValue)
     rowUpper_[elementIndex] = elementValue;
     if ((whatsChanged_ & 1) != 0) {
       // work arrays exist - update as well
-      whatsChanged_ &= ~32;
+      if (!markRimChanged(elementIndex + numberColumns_))
+        whatsChanged_ &= ~32;
       if (rowUpper_[elementIndex] == COIN_DBL_MAX) {
         rowUpperWork_[elementIndex] = COIN_DBL_MAX;
       } else if (!rowScale_) {
@@ -10451,7 +10796,8 @@ void ClpSimplex::setRowBounds(int elementIndex,
     rowLower_[elementIndex] = lowerValue;
     if ((whatsChanged_ & 1) != 0) {
       // work arrays exist - update as well
-      whatsChanged_ &= ~16;
+      if (!markRimChanged(elementIndex + numberColumns_))
+        whatsChanged_ &= ~16;
       if (rowLower_[elementIndex] == -COIN_DBL_MAX) {
         rowLowerWork_[elementIndex] = -COIN_DBL_MAX;
       } else if (!rowScale_) {
@@ -10466,7 +10812,8 @@ void ClpSimplex::setRowBounds(int elementIndex,
     rowUpper_[elementIndex] = upperValue;
     if ((whatsChanged_ & 1) != 0) {
       // work arrays exist - update as well
-      whatsChanged_ &= ~32;
+      if (!markRimChanged(elementIndex + numberColumns_))
+        whatsChanged_ &= ~32;
       if (rowUpper_[elementIndex] == COIN_DBL_MAX) {
         rowUpperWork_[elementIndex] = COIN_DBL_MAX;
       } else if (!rowScale_) {
@@ -10503,12 +10850,14 @@ void ClpSimplex::setRowSetBounds(const int *indexFirst,
     //CoinAssert (upperValue>=lowerValue);
     if (rowLower_[iRow] != lowerValue) {
       rowLower_[iRow] = lowerValue;
-      whatsChanged_ &= ~16;
+      if (!markRimChanged(iRow + numberColumns_))
+        whatsChanged_ &= ~16;
       numberChanged++;
     }
     if (rowUpper_[iRow] != upperValue) {
       rowUpper_[iRow] = upperValue;
-      whatsChanged_ &= ~32;
+      if (!markRimChanged(iRow + numberColumns_))
+        whatsChanged_ &= ~32;
       numberChanged++;
     }
   }
@@ -10552,7 +10901,8 @@ void ClpSimplex::setColumnLower(int elementIndex, double elementValue)
     columnLower_[elementIndex] = elementValue;
     if ((whatsChanged_ & 1) != 0) {
       // work arrays exist - update as well
-      whatsChanged_ &= ~128;
+      if (!markRimChanged(elementIndex))
+        whatsChanged_ &= ~128;
       double value;
       if (columnLower_[elementIndex] == -COIN_DBL_MAX) {
         value = -COIN_DBL_MAX;
@@ -10585,7 +10935,8 @@ void ClpSimplex::setColumnUpper(int elementIndex, double elementValue)
     columnUpper_[elementIndex] = elementValue;
     if ((whatsChanged_ & 1) != 0) {
       // work arrays exist - update as well
-      whatsChanged_ &= ~256;
+      if (!markRimChanged(elementIndex))
+        whatsChanged_ &= ~256;
       double value;
       if (columnUpper_[elementIndex] == COIN_DBL_MAX) {
         value = COIN_DBL_MAX;
@@ -10619,7 +10970,8 @@ void ClpSimplex::setColumnBounds(int elementIndex,
     columnLower_[elementIndex] = lowerValue;
     if ((whatsChanged_ & 1) != 0) {
       // work arrays exist - update as well
-      whatsChanged_ &= ~128;
+      if (!markRimChanged(elementIndex))
+        whatsChanged_ &= ~128;
       if (columnLower_[elementIndex] == -COIN_DBL_MAX) {
         lower_[elementIndex] = -COIN_DBL_MAX;
       } else if (!columnScale_) {
@@ -10637,7 +10989,8 @@ void ClpSimplex::setColumnBounds(int elementIndex,
     columnUpper_[elementIndex] = upperValue;
     if ((whatsChanged_ & 1) != 0) {
       // work arrays exist - update as well
-      whatsChanged_ &= ~256;
+      if (!markRimChanged(elementIndex))
+        whatsChanged_ &= ~256;
       if (columnUpper_[elementIndex] == COIN_DBL_MAX) {
         upper_[elementIndex] = COIN_DBL_MAX;
       } else if (!columnScale_) {
@@ -10674,12 +11027,14 @@ void ClpSimplex::setColumnSetBounds(const int *indexFirst,
     //CoinAssert (upperValue>=lowerValue);
     if (columnLower_[iColumn] != lowerValue) {
       columnLower_[iColumn] = lowerValue;
-      whatsChanged_ &= ~16;
+      if (!markRimChanged(iColumn))
+        whatsChanged_ &= ~128;
       numberChanged++;
     }
     if (columnUpper_[iColumn] != upperValue) {
       columnUpper_[iColumn] = upperValue;
-      whatsChanged_ &= ~32;
+      if (!markRimChanged(iColumn))
+        whatsChanged_ &= ~256;
       numberChanged++;
     }
   }
@@ -12985,6 +13340,11 @@ void ClpSimplex::resize(int newNumberRows, int newNumberColumns)
   delete[] perturbationArray_;
   perturbationArray_ = NULL;
   maximumPerturbationSize_ = 0;
+  delete[] savedRim_;
+  savedRim_ = NULL;
+  savedRimSize_ = 0;
+  numberRimChanged_ = 0;
+  maximumRimChanged_ = 0;
   if (saveStatus_) {
     // delete arrays
     int saveOptions = specialOptions_;
@@ -13048,6 +13408,67 @@ void ClpSimplex::generateCpp(FILE *fp, bool defaultFactor)
   fprintf(fp, "%d  clpModel->setPerturbation(%d);\n", iValue1 == iValue2 ? 4 : 3, iValue1);
   fprintf(fp, "%d  clpModel->setPerturbation(save_perturbation);\n", iValue1 == iValue2 ? 7 : 6);
 }
+// Switches phase profiling on (counters cleared) or off
+void ClpSimplex::setProfiling(bool yesNo)
+{
+  if (yesNo) {
+    if (!profile_)
+      profile_ = new ClpProfile;
+    clearProfile();
+  } else {
+    delete profile_;
+    profile_ = NULL;
+  }
+  if (factorization_)
+    factorization_->setProfile(profile_);
+}
+// Adds current iteration to iteration trace if sampled
+void ClpSimplex::traceIteration()
+{
+  if (iterationTrace_->wanted(numberIterations_)) {
+    ClpIterationRecord &record = iterationTrace_->pending();
+    record.iteration = numberIterations_;
+    record.sequenceIn = sequenceIn_;
+    record.sequenceOut = sequenceOut_;
+    record.pivots = factorization_->pivots();
+    if (algorithm_ > 0)
+      record.flags |= 1;
+    if (!theta_)
+      record.flags |= 2;
+    if (sequenceIn_ == sequenceOut_)
+      record.flags |= 4;
+    record.theta = theta_;
+    record.alpha = alpha_;
+    record.objective = objectiveValue();
+    iterationTrace_->add();
+  } else {
+    ClpIterationRecord &record = iterationTrace_->pending();
+    record.pivotRowLength = 0;
+    record.pivotColumnLength = 0;
+    record.flags = 0;
+  }
+}
+// Zeroes phase timings and counts
+void ClpSimplex::clearProfile()
+{
+  if (profile_)
+    memset(profile_, 0, sizeof(ClpProfile));
+}
+// Writes phase timings and counts as JSON object
+void ClpSimplex::writeProfileJson(FILE *fp) const
+{
+  static const char *phaseName[ClpProfileNumberPhases] = {
+    "ftran", "btran", "pricing", "ratioTest", "tableauRow",
+    "factorize", "createRim", "gutsOfSolution"
+  };
+  fprintf(fp, "{\n  \"iterations\": %d", numberIterations_);
+  if (profile_) {
+    for (int i = 0; i < ClpProfileNumberPhases; i++)
+      fprintf(fp, ",\n  \"%s\": {\"count\": %d, \"seconds\": %.9g}",
+        phaseName[i], profile_->count[i], profile_->time[i]);
+  }
+  fprintf(fp, "\n}\n");
+}
 // Copy across enabled stuff from one solver to another
 void ClpSimplex::copyEnabledStuff(const ClpSimplex *rhs)
 {
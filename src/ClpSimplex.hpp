@@ -18,6 +18,7 @@
 #include "ClpSolve.hpp"
 #include "ClpConfig.h"
 #include "CoinIndexedVector.hpp"
+#include "CoinTime.hpp"
 
 class ClpDualRowPivot;
 class ClpPrimalColumnPivot;
@@ -31,6 +32,7 @@ class OsiClpSolverInterface;
 class CoinWarmStartBasis;
 class ClpDisasterHandler;
 class ClpConstraint;
+class ClpIterationTrace;
 /*
   May want to use Clp defaults so that with ABC defined but not used
   it behaves as Clp (and ABC used will be different than if not defined)
@@ -86,6 +88,49 @@ class AbcSimplex;
 #define LONG_REGION_2 1
 #define SHORT_REGION 1
 #endif
+/// Phases timed by optional profiler (see ClpSimplex::setProfiling)
+enum ClpProfilePhase {
+  ClpProfileFtran = 0,
+  ClpProfileBtran,
+  ClpProfilePricing,
+  ClpProfileRatioTest,
+  ClpProfileTableauRow,
+  ClpProfileFactorize,
+  ClpProfileCreateRim,
+  ClpProfileGutsOfSolution,
+  ClpProfileNumberPhases
+};
+/** Elapsed time (seconds) and number of calls for each phase.
+    Times are inclusive so e.g. gutsOfSolution includes its FTRANs */
+typedef struct {
+  double time[ClpProfileNumberPhases];
+  int count[ClpProfileNumberPhases];
+} ClpProfile;
+/** Adds time from construction to destruction into a phase.
+    Does nothing (not even reading clock) if profile NULL */
+class ClpProfileTimer {
+public:
+  inline ClpProfileTimer(ClpProfile *profile, int phase)
+    : profile_(profile)
+    , phase_(phase)
+    , startTime_(profile ? CoinGetTimeOfDay() : 0.0)
+  {
+  }
+  inline ~ClpProfileTimer()
+  {
+    if (profile_) {
+      profile_->time[phase_] += CoinGetTimeOfDay() - startTime_;
+      profile_->count[phase_]++;
+    }
+  }
+
+private:
+  ClpProfileTimer(const ClpProfileTimer &);
+  ClpProfileTimer &operator=(const ClpProfileTimer &);
+  ClpProfile *profile_;
+  int phase_;
+  double startTime_;
+};
 /** This solves LPs using the simplex method
 
     It inherits from ClpModel and all its arrays are created at
@@ -264,6 +309,13 @@ public:
          keeps current status and solution
      */
   int loadProblem(CoinModel &modelObject, bool keepSolution = false);
+  /** Takes over ownership of arrays as ClpModel::assignProblem
+         and creates status arrays.
+         Returns number of duplicates merged */
+  int assignProblem(int numcols, int numrows,
+    CoinBigIndex *&start, int *&index, double *&value,
+    double *&collb, double *&colub, double *&obj,
+    double *&rowlb, double *&rowub, int checkType = 0);
   /// Read an mps file from the given filename
   int readMps(const char *filename,
     bool keepNames = false,
@@ -551,6 +603,10 @@ public:
           0 No pivoting (so will just be choice of algorithm)
           1 Simple pivoting e.g. gub
           2 Mini iterations
+          3 Just throw all free variables in basis
+          4 Move zero cost variables to make more primal feasible
+          5 Put singletons in basis to make more primal feasible
+          6 Triangular crash - structurals chosen so basis is triangular
      */
   int crash(double gap, int pivot);
   /// Sets row pivot choice algorithm in dual
@@ -1123,8 +1179,27 @@ protected:
          On 16 returns false if problem "bad" i.e. matrix or bounds bad
          If startFinishOptions is -1 then called by user in getSolution
          so do arrays but keep pivotVariable_
+         With permanent arrays and old matrix (startFinishOptions 4) only
+         costs and bounds whose model values differ from those saved
+         last time are recomputed
      */
   bool createRim(int what, bool makeRowCopy = false, int startFinishOptions = 0);
+  /// Recomputes scaled cost and bounds of one sequence from model arrays
+  void createRimEntry(int iSequence);
+  /** Counts sequence as changed since work arrays saved.
+         Returns false if not being tracked (or too many) */
+  inline bool markRimChanged(int)
+  {
+    if (numberRimChanged_ < maximumRimChanged_) {
+      numberRimChanged_++;
+      return true;
+    } else {
+      numberRimChanged_ = maximumRimChanged_ + 1;
+      return false;
+    }
+  }
+  /// Adds current iteration to iteration trace if sampled
+  void traceIteration();
   /// Does rows and columns
   void createRim1(bool initial);
   /// Does objective
@@ -1210,8 +1285,15 @@ public:
     st_byte = static_cast< unsigned char >(st_byte & ~7);
     st_byte = static_cast< unsigned char >(st_byte | newstatus);
   }
-  /// Start or reset using maximumRows_ and Columns_ - true if change
+  /** Start or reset using maximumRows_ and Columns_ - true if change.
+         Re-solves with old matrix (startFinishOptions 4) then only redo
+         costs and bounds whose model values changed */
   bool startPermanentArrays();
+  /// Number of times only changed costs and bounds were redone
+  inline int numberIncrementalRims() const
+  {
+    return numberIncrementalRims_;
+  }
   /** Normally the first factorization does sparse coding because
          the factorization could be singular.  This allows initial dense
          factorization when it is known to be safe
@@ -1430,6 +1512,8 @@ public:
 	 16777216 bit - if factorization kept can still declare optimal at once
 	 33554432 bit - if singular at dual startup - go to primal
 	 67108864 bit - try sorted values pass
+	 134217728 bit - dual ratio test jumps to first tentative theta
+	 by breakpoint selection if many candidates
      */
   inline int moreSpecialOptions() const
   {
@@ -1467,6 +1551,8 @@ public:
 	 16777216 bit - if factorization kept can still declare optimal at once
 	 33554432 bit - if singular at dual startup - go to primal
 	 67108864 bit - try sorted values pass
+	 134217728 bit - dual ratio test jumps to first tentative theta
+	 by breakpoint selection if many candidates
      */
   inline void setMoreSpecialOptions(int value)
   {
@@ -1627,6 +1713,30 @@ public:
   }
   /// Create C++ lines to get to current state
   void generateCpp(FILE *fp, bool defaultFactor = false);
+  /** Switches phase profiling on (counters cleared) or off.
+         Timings are elapsed seconds for FTRAN, BTRAN, pricing,
+         ratio test, row of tableau, factorize, createRim and gutsOfSolution */
+  void setProfiling(bool yesNo);
+  /// Phase timings and counts (NULL if not profiling)
+  inline const ClpProfile *profile() const
+  {
+    return profile_;
+  }
+  /// Zeroes phase timings and counts
+  void clearProfile();
+  /// Writes phase timings and counts as JSON object
+  void writeProfileJson(FILE *fp) const;
+  /** Sets iteration trace which dual and primal write sampled
+         iterations to (not owned - NULL to switch off) */
+  inline void setIterationTrace(ClpIterationTrace *trace)
+  {
+    iterationTrace_ = trace;
+  }
+  /// Iteration trace (NULL if none)
+  inline ClpIterationTrace *iterationTrace() const
+  {
+    return iterationTrace_;
+  }
   /// Gets clean and emptyish factorization
   ClpFactorization *getEmptyFactorization();
   /// May delete or may make clean and emptyish factorization
@@ -1958,6 +2068,20 @@ protected:
   int maximumPerturbationSize_;
   /// Perturbation array (maximumPerturbationSize_)
   double *perturbationArray_;
+  /// Model costs, lower and upper bounds when work arrays saved
+  double *savedRim_;
+  /// Space allocated in savedRim_ (3 * number rows and columns when saved)
+  int savedRimSize_;
+  /// Number changed by set methods since saved (> maximumRimChanged_ if all must be done)
+  int numberRimChanged_;
+  /// Most changes before all redone (0 if not tracking)
+  int maximumRimChanged_;
+  /// Number of times createRim only redid changed costs and bounds
+  int numberIncrementalRims_;
+  /// Phase timings and counts (NULL if not profiling)
+  ClpProfile *profile_;
+  /// Iteration trace (not owned, NULL if none)
+  ClpIterationTrace *iterationTrace_;
   /// A copy of model with certain state - normally without cuts
   ClpSimplex *baseModel_;
   /// For dealing with all issues of cycling etc
@@ -1969,6 +2093,8 @@ protected:
 #define CLP_ABC_WANTED_PARALLEL 2
 #define CLP_ABC_FULL_DONE 8
   // bits 256,512,1024 for crash
+  // results must not depend on number of threads (fixed parallelMode)
+#define CLP_ABC_DETERMINISTIC 4096
 #endif
 #define CLP_ABC_BEEN_FEASIBLE 65536
   /// Number of degenerate pivots since last perturbed
@@ -2126,17 +2252,30 @@ void moveAndZero(clpTempInfo *info, int type, void *extra);
 #ifdef ABCSTATE_LITE
 #if ABCSTATE_LITE == 2
 int abcState_ = 0;
+int abcDeterministic_ = 0;
 #else
 extern int abcState_;
+extern int abcDeterministic_;
 #endif
+/* Number of blocks work is split into.  In deterministic mode this is
+   always ABOCA_LITE (cilk decides how many threads do the blocks) so
+   iterations and results are the same for any number of threads */
 inline int abcState()
 {
-  return abcState_;
+  return (abcDeterministic_ && abcState_) ? ABOCA_LITE : abcState_;
 }
 inline void setAbcState(int state)
 {
   abcState_ = state;
 }
+inline bool abcDeterministic()
+{
+  return abcDeterministic_ != 0;
+}
+inline void setAbcDeterministic(bool yesNo)
+{
+  abcDeterministic_ = yesNo ? 1 : 0;
+}
 #endif
 #else
 #define abcState 0
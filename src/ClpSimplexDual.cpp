@@ -103,6 +103,7 @@
 //#define FAKE_CILK
 #include "ClpSimplexDual.hpp"
 #include "ClpEventHandler.hpp"
+#include "ClpIterationTrace.hpp"
 #include "ClpFactorization.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinIndexedVector.hpp"
@@ -113,6 +114,7 @@
 #include "CoinTime.hpp"
 #include <cfloat>
 #include <cassert>
+#include <algorithm>
 #include <string>
 #include <stdio.h>
 #include <iostream>
@@ -1256,6 +1258,7 @@ int ClpSimplexDual::whileIterating(double *&givenDuals, int ifValuesPass)
         sequenceIn_ = -1;
         // put row of tableau in rowArray[0] and columnArray[0]
         assert(!rowArray_[1]->getNumElements());
+        double profileTime = profile_ ? CoinGetTimeOfDay() : 0.0;
         if (!scaledMatrix_) {
           if ((moreSpecialOptions_ & 8) != 0 && !rowScale_)
             spareIntArray_[0] = 1;
@@ -1273,6 +1276,10 @@ int ClpSimplexDual::whileIterating(double *&givenDuals, int ifValuesPass)
           rowScale_ = saveR;
           columnScale_ = saveC;
         }
+        if (profile_) {
+          profile_->time[ClpProfileTableauRow] += CoinGetTimeOfDay() - profileTime;
+          profile_->count[ClpProfileTableauRow]++;
+        }
 #ifdef CLP_REPORT_PROGRESS
         memcpy(savePSol, solution_, (numberColumns_ + numberRows_) * sizeof(double));
         memcpy(saveDj, dj_, (numberColumns_ + numberRows_) * sizeof(double));
@@ -1287,6 +1294,8 @@ int ClpSimplexDual::whileIterating(double *&givenDuals, int ifValuesPass)
           columnArray_[1],
 #endif
           acceptablePivot, dubiousWeights);
+        if (iterationTrace_)
+          iterationTrace_->pending().pivotRowLength = rowArray_[0]->getNumElements() + columnArray_[0]->getNumElements();
         if (sequenceIn_ < 0 && acceptablePivot > acceptablePivot_)
           acceptablePivot_ = -fabs(acceptablePivot_); // stop early exit
 #if CAN_HAVE_ZERO_OBJ > 1
@@ -1398,6 +1407,8 @@ int ClpSimplexDual::whileIterating(double *&givenDuals, int ifValuesPass)
           rowArray_[2],
           rowArray_[3],
           rowArray_[1]);
+        if (iterationTrace_)
+          iterationTrace_->pending().pivotColumnLength = rowArray_[1]->getNumElements();
         // see if update stable
 #ifdef CLP_DEBUG
         if ((handler_->logLevel() & 32))
@@ -1813,6 +1824,8 @@ int ClpSimplexDual::whileIterating(double *&givenDuals, int ifValuesPass)
           returnCode = 3;
           break;
         }
+        if (iterationTrace_)
+          traceIteration();
         // Check event
         {
           int status = eventHandler_->event(ClpEventHandler::endOfIteration);
@@ -3017,8 +3030,10 @@ void ClpSimplexDual::dualRow(int alreadyChosen)
 #endif
     pivotRow_ = chosenRow;
   }
-  if (chosenRow < 0)
+  if (chosenRow < 0) {
+    ClpProfileTimer timer(profile_, ClpProfilePricing);
     pivotRow_ = dualRowPivot_->pivotRow();
+  }
 
   if (pivotRow_ >= 0) {
     sequenceOut_ = pivotVariable_[pivotRow_];
@@ -3982,6 +3997,60 @@ int ClpSimplexDual::dualColumn0(const CoinIndexedVector *rowArray,
   upperReturn = upperTheta;
   return numberRemaining;
 }
+/* Number of candidates above which dualColumn selects first tentative theta
+   (only if moreSpecialOptions_ 134217728 bit set) */
+#ifndef CLP_DUAL_LONG_STEP_SELECT
+#define CLP_DUAL_LONG_STEP_SELECT 200
+#endif
+// Orders candidate positions by breakpoint
+struct clpBreakpointLess {
+  const double *breakpoint;
+  bool operator()(int a, int b) const
+  {
+    return breakpoint[a] < breakpoint[b];
+  }
+};
+/* Candidates have alpha in spare and sequence in index.
+   Returns breakpoint at which sum of range*fabs(alpha) of candidates
+   which have already gone through reaches target.
+   breakpoint and position are work arrays of size number.
+   Uses selection rather than sort so expected work is linear */
+static double
+longStepBreakpoint(int number, const double *COIN_RESTRICT spare,
+  const int *COIN_RESTRICT index, const double *COIN_RESTRICT dj,
+  const double *COIN_RESTRICT lower, const double *COIN_RESTRICT upper,
+  double tolerance, double target,
+  double *COIN_RESTRICT breakpoint, int *COIN_RESTRICT position)
+{
+  for (int i = 0; i < number; i++) {
+    double alpha = spare[i];
+    // alpha negative means at upper bound
+    double shift = alpha < 0.0 ? -tolerance : tolerance;
+    breakpoint[i] = (dj[index[i]] + shift) / alpha;
+    position[i] = i;
+  }
+  clpBreakpointLess less;
+  less.breakpoint = breakpoint;
+  int lo = 0;
+  int hi = number;
+  while (hi - lo > 1) {
+    int mid = (lo + hi) >> 1;
+    std::nth_element(position + lo, position + mid, position + hi, less);
+    double sum = 0.0;
+    for (int i = lo; i < mid; i++) {
+      int j = position[i];
+      int iSequence = index[j];
+      sum += (upper[iSequence] - lower[iSequence]) * fabs(spare[j]);
+    }
+    if (sum >= target) {
+      hi = mid;
+    } else {
+      target -= sum;
+      lo = mid;
+    }
+  }
+  return breakpoint[position[lo]];
+}
 /*
    Row array has row part of pivot row (as duals so sign may be switched)
    Column array has column part.
@@ -3998,6 +4067,7 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
   double acceptablePivot,
   CoinBigIndex * /*dubiousWeights*/)
 {
+  ClpProfileTimer timer(profile_, ClpProfileRatioTest);
   int numberPossiblySwapped = 0;
   int numberRemaining = 0;
 
@@ -4128,6 +4198,19 @@ ClpSimplexDual::dualColumn(CoinIndexedVector *rowArray,
     theta_ = 1.0e50;
     // now flip flop between spare arrays until reasonable theta
     tentativeTheta = CoinMax(10.0 * upperTheta, 1.0e-7);
+    if ((moreSpecialOptions_ & 134217728) != 0
+      && interesting[0] > CLP_DUAL_LONG_STEP_SELECT && dualOut_) {
+      /* Many candidates - rather than doubling tentativeTheta a pass
+         at a time jump to where about half of dualOut_ has gone through.
+         First pass then flips all those in one batch */
+      double newTheta = longStepBreakpoint(interesting[0], array[0], indices[0],
+        dj_, lower_, upper_, newTolerance, 0.5 * fabs(dualOut_),
+        array[1], indices[1]);
+      // work arrays must be zeroed after
+      marker[1][0] = CoinMax(marker[1][0], interesting[0]);
+      if (newTheta > tentativeTheta && newTheta < 1.0e22)
+        tentativeTheta = newTheta;
+    }
 
     // loops increasing tentative theta until can't go through
 
@@ -26,6 +26,7 @@
 #include <cfloat>
 #include <cassert>
 #include <string>
+#include <vector>
 #include <stdio.h>
 #include <iostream>
 #ifdef INT_IS_8
@@ -2536,12 +2537,17 @@ int ClpSimplexOther::parametrics(double startingTheta, double &endingTheta, doub
       }
       double *saveDuals = NULL;
       reinterpret_cast< ClpSimplexDual * >(this)->gutsOfDual(0, saveDuals, -1, data);
-      assert(!problemStatus_);
-      for (int i = 0; i < numberRows_ + numberColumns_; i++)
-        setFakeBound(i, noFake);
-      // Now do parametrics
-      handler_->message(CLP_PARAMETRICS_STATS, messages_)
-        << startingTheta << objectiveValue() << CoinMessageEol;
+      if (problemStatus_) {
+        // e.g. infeasible at startingTheta - can not move at all
+        returnCode = problemStatus_;
+        endingTheta = startingTheta;
+      } else {
+        for (int i = 0; i < numberRows_ + numberColumns_; i++)
+          setFakeBound(i, noFake);
+        // Now do parametrics
+        handler_->message(CLP_PARAMETRICS_STATS, messages_)
+          << startingTheta << objectiveValue() << CoinMessageEol;
+      }
       while (!returnCode) {
         //assert (reportIncrement);
         parametricsData paramData;
@@ -2657,6 +2663,153 @@ int ClpSimplexOther::parametrics(double startingTheta, double &endingTheta, doub
     << line << CoinMessageEol;
   return problemStatus_;
 }
+/* Collects theta and objective (and names for basis changes) from
+   parametrics reports of one sub-interval so they can be given in order
+   afterwards */
+class ClpParametricsMessageHandler : public CoinMessageHandler {
+public:
+  ClpParametricsMessageHandler()
+    : CoinMessageHandler()
+  {
+  }
+  virtual int print()
+  {
+    if (currentSource() == "Clp" && numberDoubleFields() >= 2) {
+      int number = currentMessage().externalNumber();
+      if (number == 62 || (number == 63 && numberStringFields() >= 2)) {
+        // CLP_PARAMETRICS_STATS or CLP_PARAMETRICS_STATS2
+        number_.push_back(number);
+        theta_.push_back(doubleValue(0));
+        objective_.push_back(doubleValue(1));
+        in_.push_back(number == 63 ? stringValue(0) : std::string());
+        out_.push_back(number == 63 ? stringValue(1) : std::string());
+      }
+    }
+    return 0;
+  }
+  virtual CoinMessageHandler *clone() const
+  {
+    return new ClpParametricsMessageHandler(*this);
+  }
+  std::vector< int > number_;
+  std::vector< double > theta_;
+  std::vector< double > objective_;
+  std::vector< std::string > in_;
+  std::vector< std::string > out_;
+};
+typedef struct {
+  ClpSimplex *model;
+  double startingTheta;
+  double endingTheta;
+  double reportIncrement;
+  const double *changeLowerBound;
+  const double *changeUpperBound;
+  const double *changeLowerRhs;
+  const double *changeUpperRhs;
+  const double *changeObjective;
+  int returnCode;
+} clpParametricsInfo;
+static void parametricsBit(clpParametricsInfo &info)
+{
+  info.returnCode = static_cast< ClpSimplexOther * >(info.model)->parametrics(info.startingTheta, info.endingTheta, info.reportIncrement,
+    info.changeLowerBound, info.changeUpperBound,
+    info.changeLowerRhs, info.changeUpperRhs, info.changeObjective);
+}
+/* Parametrics with [startingTheta,endingTheta] split into sub-intervals
+   each done on a copy of model starting from current basis */
+int ClpSimplexOther::parametricsParallel(int numberIntervals,
+  double startingTheta, double &endingTheta, double reportIncrement,
+  const double *lowerChangeBound, const double *upperChangeBound,
+  const double *lowerChangeRhs, const double *upperChangeRhs,
+  const double *changeObjective)
+{
+  if (numberIntervals > 64)
+    numberIntervals = 64;
+  if (numberIntervals < 2 || endingTheta <= startingTheta || endingTheta >= 1.0e50)
+    return parametrics(startingTheta, endingTheta, reportIncrement,
+      lowerChangeBound, upperChangeBound, lowerChangeRhs, upperChangeRhs,
+      changeObjective);
+  double length = (endingTheta - startingTheta) / numberIntervals;
+  if (reportIncrement > 0.0) {
+    // so reports are at same theta as one sweep
+    length = ceil(length / reportIncrement) * reportIncrement;
+  }
+  clpParametricsInfo info[64];
+  ClpParametricsMessageHandler handler[64];
+  double target[64];
+  int numberCopies = 0;
+  double theta = startingTheta;
+  while (numberCopies < numberIntervals && theta < endingTheta) {
+    clpParametricsInfo &thisInfo = info[numberCopies];
+    thisInfo.model = new ClpSimplex(*this);
+    // same log level so same reports are made
+    handler[numberCopies].setLogLevel(handler_->logLevel());
+    thisInfo.model->passInMessageHandler(handler + numberCopies);
+    thisInfo.startingTheta = theta;
+    theta = CoinMin(theta + length, endingTheta);
+    if (numberCopies == numberIntervals - 1)
+      theta = endingTheta;
+    thisInfo.endingTheta = theta;
+    target[numberCopies] = theta;
+    thisInfo.reportIncrement = reportIncrement;
+    thisInfo.changeLowerBound = lowerChangeBound;
+    thisInfo.changeUpperBound = upperChangeBound;
+    thisInfo.changeLowerRhs = lowerChangeRhs;
+    thisInfo.changeUpperRhs = upperChangeRhs;
+    thisInfo.changeObjective = changeObjective;
+    thisInfo.returnCode = 0;
+    numberCopies++;
+  }
+#if ABOCA_LITE && !defined(ABC_INHERIT)
+  for (int i = 0; i < numberCopies - 1; i++)
+    cilk_spawn parametricsBit(info[i]);
+  parametricsBit(info[numberCopies - 1]);
+  cilk_sync;
+#else
+  for (int i = 0; i < numberCopies; i++)
+    parametricsBit(info[i]);
+#endif
+  // stitch together - stop at first which did not get to end
+  int last = numberCopies - 1;
+  int numberIterations = numberIterations_;
+  for (int i = 0; i < numberCopies; i++) {
+    const ClpParametricsMessageHandler &thisHandler = handler[i];
+    for (size_t k = 0; k < thisHandler.theta_.size(); k++) {
+      if (thisHandler.number_[k] == 63) {
+        handler_->message(CLP_PARAMETRICS_STATS2, messages_)
+          << thisHandler.theta_[k] << thisHandler.objective_[k]
+          << thisHandler.in_[k] << thisHandler.out_[k] << CoinMessageEol;
+      } else if (!i || k || thisHandler.theta_[k] != info[i].startingTheta) {
+        // (start of later ones was end of previous one)
+        handler_->message(CLP_PARAMETRICS_STATS, messages_)
+          << thisHandler.theta_[k] << thisHandler.objective_[k] << CoinMessageEol;
+      }
+    }
+    numberIterations += info[i].model->numberIterations() - numberIterations_;
+    if (info[i].returnCode || info[i].endingTheta < target[i]) {
+      last = i;
+      break;
+    }
+  }
+  ClpSimplex *lastModel = info[last].model;
+  endingTheta = info[last].endingTheta;
+  int numberTotal = numberRows_ + numberColumns_;
+  CoinMemcpyN(lastModel->statusArray(), numberTotal, status_);
+  CoinMemcpyN(lastModel->primalColumnSolution(), numberColumns_, columnActivity_);
+  CoinMemcpyN(lastModel->primalRowSolution(), numberRows_, rowActivity_);
+  CoinMemcpyN(lastModel->dualColumnSolution(), numberColumns_, reducedCost_);
+  CoinMemcpyN(lastModel->dualRowSolution(), numberRows_, dual_);
+  objectiveValue_ = lastModel->objectiveValue();
+  problemStatus_ = lastModel->problemStatus();
+  numberIterations_ = numberIterations;
+  for (int i = 0; i < numberCopies; i++)
+    delete info[i].model;
+  char line[100];
+  sprintf(line, "Ending theta %g\n", endingTheta);
+  handler_->message(CLP_GENERAL, messages_)
+    << line << CoinMessageEol;
+  return problemStatus_;
+}
 /* Version of parametrics which reads from file
    See CbcClpParam.cpp for details of format
    Returns -2 if unable to open file */
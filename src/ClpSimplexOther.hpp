@@ -104,6 +104,21 @@ public:
     const double *changeLowerRhs, const double *changeUpperRhs);
   int parametricsObj(double startingTheta, double &endingTheta,
     const double *changeObjective);
+  /** Parametrics as above but [startingTheta,endingTheta] is split into
+         numberIntervals sub-intervals.  Each is done by parametrics on a
+         copy of model starting from current basis (on its own thread if
+         ABOCA_LITE).  Theta and objective reports (and basis changes at
+         log level 2) are then given in order and model is left as if one
+         sweep had stopped where first sub-interval which could not reach
+         its end stopped (possibly at its start if infeasible there).
+         If reportIncrement >0.0 sub-intervals are multiples of it so
+         reports are at same values of theta as one sweep.
+     */
+  int parametricsParallel(int numberIntervals,
+    double startingTheta, double &endingTheta, double reportIncrement,
+    const double *changeLowerBound, const double *changeUpperBound,
+    const double *changeLowerRhs, const double *changeUpperRhs,
+    const double *changeObjective);
   /// Finds best possible pivot
   double bestPivot(bool justColumns = false);
   typedef struct {
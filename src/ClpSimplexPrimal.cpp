@@ -90,6 +90,7 @@
 #include "ClpPrimalColumnPivot.hpp"
 #include "ClpMessage.hpp"
 #include "ClpEventHandler.hpp"
+#include "ClpIterationTrace.hpp"
 #include "ClpSimplexPrimal.hpp"
 #include "CoinTime.hpp"
 #include <cfloat>
@@ -1842,6 +1843,7 @@ void ClpSimplexPrimal::primalRow(CoinIndexedVector *rowArray,
   CoinIndexedVector *spareArray,
   int valuesPass)
 {
+  ClpProfileTimer timer(profile_, ClpProfileRatioTest);
   double saveDj = dualIn_;
   if (valuesPass && objective_->type() < 2) {
     dualIn_ = cost_[sequenceIn_];
@@ -2480,7 +2482,7 @@ void ClpSimplexPrimal::primalColumn(CoinIndexedVector *updates,
   CoinIndexedVector *spareColumn1,
   CoinIndexedVector *spareColumn2)
 {
-
+  ClpProfileTimer timer(profile_, ClpProfilePricing);
   ClpMatrixBase *saveMatrix = matrix_;
   double *saveRowScale = rowScale_;
   if (scaledMatrix_) {
@@ -3321,6 +3323,8 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
     // save reduced cost
     double saveDj = dualIn_;
     factorization_->updateColumnFT(rowArray_[2], rowArray_[1]);
+    if (iterationTrace_)
+      iterationTrace_->pending().pivotColumnLength = rowArray_[1]->getNumElements();
     // Get extra rows
     matrix_->extendUpdated(this, rowArray_[1], 0);
 #ifdef ALT_UPDATE_WEIGHTS
@@ -3738,6 +3742,8 @@ int ClpSimplexPrimal::pivotResult(int ifValuesPass)
       // done a lot of flips - be safe
       returnCode = -2; // refactorize
     }
+    if (iterationTrace_)
+      traceIteration();
     // Check event
     {
       int status = eventHandler_->event(ClpEventHandler::endOfIteration);
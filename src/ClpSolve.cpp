@@ -6,6 +6,10 @@
 
 #include "CoinPragma.hpp"
 #include "ClpConfig.h"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 
 // check already here if CLP_HAS_GLPK is defined, since we do not want to get confused by a CLP_HAS_GLPK in config_coinutils.h
 #if defined(CLP_HAS_AMD) || defined(CLP_HAS_CHOLMOD) || defined(CLP_HAS_GLPK)
@@ -13,6 +17,9 @@
 #endif
 
 #include <math.h>
+#if ABOCA_LITE
+#include <atomic>
+#endif
 #ifdef _MSC_VER
 #include <windows.h> // for Sleep()
 #ifdef small
@@ -688,7 +695,12 @@ ClpSimplex::dealWithAbc(int solveType, int startUp,
     }
 #endif
 #endif
-    abcModel2->setParallelMode(numberCpu - 1);
+    if ((this->abcState() & CLP_ABC_DETERMINISTIC) != 0) {
+      // always same blocks (and so same iterations) whatever number of workers
+      abcModel2->setParallelMode(3);
+    } else {
+      abcModel2->setParallelMode(numberCpu - 1);
+    }
 #endif
     //if (abcState()==3||abcState()==4) {
     //abcModel2->setMoreSpecialOptions((131072*2)|abcModel2->moreSpecialOptions());
@@ -838,6 +850,152 @@ ClpSimplex::dealWithAbc(int solveType, int startUp,
   return abcModel2;
 }
 #endif
+/* Counts dense columns which make forming A D A' expensive and sets
+   denseLength to length from which a column counts as dense.
+   fraction is share of the work of A D A' due to those columns. */
+static int denseColumns(const ClpSimplex *model, int &denseLength,
+  double &fraction)
+{
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+  fraction = 0.0;
+  denseLength = COIN_INT_MAX;
+  if (!numberColumns)
+    return 0;
+  const int *columnLength = model->clpMatrix()->getVectorLengths();
+  CoinBigIndex numberElements = model->clpMatrix()->getNumElements();
+  int averageLength = static_cast< int >(numberElements / numberColumns);
+  denseLength = CoinMax(100, CoinMax(numberRows / 10, 10 * averageLength));
+  // work in forming A D A' is sum of squares of column lengths
+  double work = 0.0;
+  double denseWork = 0.0;
+  int numberDense = 0;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    double length = columnLength[iColumn];
+    work += length * length;
+    if (columnLength[iColumn] >= denseLength) {
+      numberDense++;
+      denseWork += length * length;
+    }
+  }
+  if (work)
+    fraction = denseWork / work;
+  return numberDense;
+}
+#if ABOCA_LITE && !defined(ABC_INHERIT)
+/* Crossover race - primal and dual cleanups start from the same basis
+   and whichever finishes first stops the other at its next iteration.
+   Any event handler the user had on the model is still called. */
+class ClpCrossoverEventHandler : public ClpEventHandler {
+public:
+  ClpCrossoverEventHandler(const ClpEventHandler *userHandler,
+    std::atomic< int > *finished)
+    : ClpEventHandler()
+    , userHandler_(userHandler ? userHandler->clone() : NULL)
+    , finished_(finished)
+  {
+  }
+  ClpCrossoverEventHandler(const ClpCrossoverEventHandler &rhs)
+    : ClpEventHandler(rhs)
+    , userHandler_(rhs.userHandler_ ? rhs.userHandler_->clone() : NULL)
+    , finished_(rhs.finished_)
+  {
+  }
+  virtual ~ClpCrossoverEventHandler()
+  {
+    delete userHandler_;
+  }
+  virtual int event(Event whichEvent)
+  {
+    if (whichEvent == endOfIteration && finished_ && finished_->load())
+      return 0; // stop
+    if (userHandler_) {
+      userHandler_->setSimplex(model_);
+      return userHandler_->event(whichEvent);
+    }
+    return -1;
+  }
+  virtual int eventWithInfo(Event whichEvent, void *info)
+  {
+    if (userHandler_) {
+      userHandler_->setSimplex(model_);
+      return userHandler_->eventWithInfo(whichEvent, info);
+    }
+    return -1;
+  }
+  virtual ClpEventHandler *clone() const
+  {
+    return new ClpCrossoverEventHandler(*this);
+  }
+
+private:
+  ClpCrossoverEventHandler &operator=(const ClpCrossoverEventHandler &);
+  /// Handler model had (owned)
+  ClpEventHandler *userHandler_;
+  /// Set when one has finished (NULL if both must finish)
+  std::atomic< int > *finished_;
+};
+static void crossoverPrimalBit(ClpSimplex *model, std::atomic< int > *finished)
+{
+  double saveScale = model->objectiveScale();
+  model->setObjectiveScale(1.0e-3);
+  model->primal(2);
+  model->setObjectiveScale(saveScale);
+  if (!finished->load())
+    model->primal(1);
+  if (!model->problemStatus())
+    finished->store(1);
+}
+static void crossoverDualBit(ClpSimplex *model, std::atomic< int > *finished)
+{
+  model->dual();
+  if (!model->problemStatus())
+    finished->store(1);
+}
+/* Runs primal and dual crossover concurrently on copies of model
+   and puts winning basis and solution back.  Pivots done by winner
+   are added to iteration count of model.
+   In deterministic mode neither is stopped early and primal wins
+   if optimal, so result does not depend on which thread was faster. */
+static void concurrentCrossover(ClpSimplex *model)
+{
+  std::atomic< int > finished(0);
+  // in deterministic mode primal must not see dual finish
+  std::atomic< int > primalFinished(0);
+  bool deterministic = abcDeterministic();
+  ClpSimplex primalModel(*model);
+  ClpSimplex dualModel(*model);
+  {
+    ClpCrossoverEventHandler handler(primalModel.eventHandler(),
+      deterministic ? NULL : &finished);
+    primalModel.passInEventHandler(&handler);
+    dualModel.passInEventHandler(&handler);
+  }
+  cilk_spawn crossoverPrimalBit(&primalModel,
+    deterministic ? &primalFinished : &finished);
+  crossoverDualBit(&dualModel, &finished);
+  cilk_sync;
+  ClpSimplex *winner = &primalModel;
+  if (primalModel.problemStatus() && !dualModel.problemStatus())
+    winner = &dualModel;
+  int numberRows = model->numberRows();
+  int numberColumns = model->numberColumns();
+  CoinMemcpyN(winner->statusArray(), numberRows + numberColumns,
+    model->statusArray());
+  CoinMemcpyN(winner->primalRowSolution(), numberRows,
+    model->primalRowSolution());
+  CoinMemcpyN(winner->dualRowSolution(), numberRows,
+    model->dualRowSolution());
+  CoinMemcpyN(winner->primalColumnSolution(), numberColumns,
+    model->primalColumnSolution());
+  CoinMemcpyN(winner->dualColumnSolution(), numberColumns,
+    model->dualColumnSolution());
+  // copies started with iteration count of model
+  model->setNumberIterations(winner->numberIterations());
+  // make sure model is clean (should be no pivots if winner optimal)
+  model->primal(1);
+}
+#endif
 /** General solve algorithm which can do presolve
     special options (bits)
     1 - do not perturb
@@ -1048,6 +1206,10 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       }
     }
   }
+  // see if scales for this pattern known
+  ClpScaleCache *scaleCache = options.scaleCache();
+  if (scaleCache && model2->scalingFlag() > 0 && !model2->rowScale())
+    scaleCache->apply(model2);
 #ifdef CLP_USEFUL_PRINTOUT
   debugInt[3] = model2->numberRows();
   debugInt[4] = model2->numberColumns();
@@ -1850,7 +2012,7 @@ int ClpSimplex::initialSolve(ClpSolve &options)
 #endif
     if (doCrash) {
 #ifdef ABC_INHERIT
-      if (!model2->abcState()) {
+      if (!model2->abcState() || doCrash == 7) {
 #endif
         switch (doCrash) {
           // standard
@@ -1874,6 +2036,10 @@ int ClpSimplex::initialSolve(ClpSolve &options)
         case 6:
           model2->crash(0.0, 5);
           break;
+          // Triangular
+        case 7:
+          model2->crash(0.0, 6);
+          break;
         }
 #ifdef ABC_INHERIT
       } else if (doCrash >= 0) {
@@ -2402,6 +2568,10 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       case 6:
 	model2->crash(0.0, 5);
 	break;
+	// Triangular
+      case 7:
+	model2->crash(0.0, 6);
+	break;
       }
     }
 #ifndef SLIM_CLP
@@ -3187,16 +3357,48 @@ int ClpSimplex::initialSolve(ClpSolve &options)
     if (quadraticObj) {
       doKKT = true;
     }
+    /* If dense columns would make normal equations too costly take them
+       out by a low rank update or if too many use KKT */
+    int denseThreshold = options.getExtraInfo(1);
+    bool autoKKT = false;
+    if (!doKKT && !barrierOptions && denseThreshold <= 0) {
+      int denseLength;
+      double fraction;
+      int numberDense = denseColumns(model2, denseLength, fraction);
+      char line[100];
+      if (numberDense > CLP_MAXIMUM_DENSE_COLUMNS && fraction > 0.5) {
+        sprintf(line, "%d dense columns - factorizing KKT system", numberDense);
+        doKKT = true;
+        autoKKT = true;
+      } else if (numberDense && numberDense <= CLP_MAXIMUM_DENSE_COLUMNS
+        && fraction > 0.1) {
+        sprintf(line, "%d dense columns (length >= %d) taken out of normal equations",
+          numberDense, denseLength);
+        denseThreshold = denseLength;
+      } else {
+        numberDense = 0;
+      }
+      if (numberDense)
+        handler_->message(CLP_GENERAL, messages_)
+          << line
+          << CoinMessageEol;
+    }
     switch (barrierOptions) {
     case 0:
     default:
       if (!doKKT) {
-        ClpCholeskyBase *cholesky = new ClpCholeskyBase(options.getExtraInfo(1));
-        cholesky->setIntegerParameter(0, speed);
+        // may be kept from last solve so ordering can be reused
+        ClpCholeskyBase *cholesky = options.barrierCholesky();
+        if (!cholesky) {
+          cholesky = new ClpCholeskyBase(denseThreshold);
+          cholesky->setIntegerParameter(0, speed);
+        }
         barrier.setCholesky(cholesky);
       } else {
         ClpCholeskyBase *cholesky = new ClpCholeskyBase();
         cholesky->setKKT(true);
+        if (autoKKT)
+          cholesky->setKKTRegularization(1.0e-9, 1.0e-9);
         barrier.setCholesky(cholesky);
       }
       break;
@@ -3310,6 +3512,9 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       barrier.scaling(1);
     else
       barrier.scaling(0);
+    // warm start only makes sense if solution is of this model
+    if (model2 == this)
+      barrier.setWarmStart(options.barrierWarmStart());
     barrier.primalDual();
 #elif SAVEIT == 1
     barrier.primalDual();
@@ -3325,6 +3530,9 @@ int ClpSimplex::initialSolve(ClpSolve &options)
     CoinMemcpyN(model2->dualColumnSolution(),
       numberColumns, barrier.dualColumnSolution());
 #endif
+    // user keeps ownership of cholesky
+    if (options.barrierCholesky() && barrier.cholesky() == options.barrierCholesky())
+      barrier.releaseCholesky();
     time2 = CoinCpuTime();
     timeCore = time2 - timeX;
     handler_->message(CLP_INTERVAL_TIMING, messages_)
@@ -3513,6 +3721,7 @@ int ClpSimplex::initialSolve(ClpSolve &options)
         saveUpper = NULL;
       }
     }
+    int crossoverIterations = model2->numberIterations();
     if (method == ClpSolve::useBarrier || barrierStatus < 0) {
       if (maxIts && barrierStatus < 4 && !quadraticObj) {
         //printf("***** crossover - needs more thought on difficult models\n");
@@ -3672,11 +3881,19 @@ int ClpSimplex::initialSolve(ClpSolve &options)
           CoinMemcpyN(columnPrimal,
             numberColumns, model2->primalColumnSolution());
         }
-        double saveScale = model2->objectiveScale();
-        model2->setObjectiveScale(1.0e-3);
-        model2->primal(2);
-        model2->setObjectiveScale(saveScale);
-        model2->primal(1);
+#if ABOCA_LITE
+        if (options.parallelCrossover()) {
+          concurrentCrossover(model2);
+        } else {
+#endif
+          double saveScale = model2->objectiveScale();
+          model2->setObjectiveScale(1.0e-3);
+          model2->primal(2);
+          model2->setObjectiveScale(saveScale);
+          model2->primal(1);
+#if ABOCA_LITE
+        }
+#endif
 #endif
 #else
         // just primal
@@ -3704,6 +3921,7 @@ int ClpSimplex::initialSolve(ClpSolve &options)
         model2->reducedGradient(1);
       }
     }
+    crossoverIterations = model2->numberIterations() - crossoverIterations;
 
     //model2->setMaximumIterations(saveMaxIts);
 #ifdef BORROW
@@ -3731,12 +3949,16 @@ int ClpSimplex::initialSolve(ClpSolve &options)
       delete[] saveUpper;
       saveLower = NULL;
       saveUpper = NULL;
-      if (method != ClpSolve::useBarrierNoCross)
+      if (method != ClpSolve::useBarrierNoCross) {
+        int saveIterations = model2->numberIterations();
         model2->primal(1);
+        crossoverIterations += model2->numberIterations() - saveIterations;
+      }
     }
     model2->setPerturbation(savePerturbation);
     time2 = CoinCpuTime();
     timeCore = time2 - timeX;
+    options.setCrossoverStatistics(timeCore, crossoverIterations);
     handler_->message(CLP_INTERVAL_TIMING, messages_)
       << "Crossover" << timeCore << time2 - time1
       << CoinMessageEol;
@@ -3761,6 +3983,8 @@ int ClpSimplex::initialSolve(ClpSolve &options)
   }
   numberIterations = model2->numberIterations();
   finalStatus = model2->status();
+  if (scaleCache && model2->rowScale())
+    scaleCache->save(model2);
   int finalSecondaryStatus = model2->secondaryStatus();
   if (presolve == ClpSolve::presolveOn) {
     int saveLevel = logLevel();
@@ -4027,6 +4251,12 @@ ClpSolve::ClpSolve()
   independentOptions_[1] = 512;
   // Substitute up to 3
   independentOptions_[2] = 3;
+  scaleCache_ = NULL;
+  barrierCholesky_ = NULL;
+  barrierWarmStart_ = 0.0;
+  crossoverTime_ = 0.0;
+  crossoverIterations_ = 0;
+  parallelCrossover_ = false;
 }
 // Constructor when you really know what you are doing
 ClpSolve::ClpSolve(SolveType method, PresolveType presolveType,
@@ -4045,6 +4275,12 @@ ClpSolve::ClpSolve(SolveType method, PresolveType presolveType,
   extraInfo_[6] = 0;
   for (i = 0; i < 3; i++)
     independentOptions_[i] = independentOptions[i];
+  scaleCache_ = NULL;
+  barrierCholesky_ = NULL;
+  barrierWarmStart_ = 0.0;
+  crossoverTime_ = 0.0;
+  crossoverIterations_ = 0;
+  parallelCrossover_ = false;
 }
 
 // Copy constructor.
@@ -4060,6 +4296,12 @@ ClpSolve::ClpSolve(const ClpSolve &rhs)
     extraInfo_[i] = rhs.extraInfo_[i];
   for (i = 0; i < 3; i++)
     independentOptions_[i] = rhs.independentOptions_[i];
+  scaleCache_ = rhs.scaleCache_;
+  barrierCholesky_ = rhs.barrierCholesky_;
+  barrierWarmStart_ = rhs.barrierWarmStart_;
+  crossoverTime_ = rhs.crossoverTime_;
+  crossoverIterations_ = rhs.crossoverIterations_;
+  parallelCrossover_ = rhs.parallelCrossover_;
 }
 // Assignment operator. This copies the data
 ClpSolve &
@@ -4076,6 +4318,12 @@ ClpSolve::operator=(const ClpSolve &rhs)
       extraInfo_[i] = rhs.extraInfo_[i];
     for (i = 0; i < 3; i++)
       independentOptions_[i] = rhs.independentOptions_[i];
+    scaleCache_ = rhs.scaleCache_;
+    barrierCholesky_ = rhs.barrierCholesky_;
+    barrierWarmStart_ = rhs.barrierWarmStart_;
+    crossoverTime_ = rhs.crossoverTime_;
+    crossoverIterations_ = rhs.crossoverIterations_;
+    parallelCrossover_ = rhs.parallelCrossover_;
   }
   return *this;
 }
@@ -15,6 +15,8 @@
     passing parameters to initialSolve and maybe for output from that
 
 */
+class ClpScaleCache;
+class ClpCholeskyBase;
 
 class CLPLIB_EXPORT ClpSolve {
 
@@ -278,6 +280,65 @@ public:
   {
     return independentOptions_[type];
   }
+  /** Cache of scale factors (not owned).  If set, initialSolve
+      takes scales from it when pattern matches and saves them after */
+  inline ClpScaleCache *scaleCache() const
+  {
+    return scaleCache_;
+  }
+  inline void setScaleCache(ClpScaleCache *cache)
+  {
+    scaleCache_ = cache;
+  }
+  /** Cholesky kept between barrier solves (not owned).  If set (and
+      normal equations are used) initialSolve uses it instead of creating
+      one, so ordering and symbolic factorization are reused while the
+      structure of the matrix is unchanged */
+  inline ClpCholeskyBase *barrierCholesky() const
+  {
+    return barrierCholesky_;
+  }
+  inline void setBarrierCholesky(ClpCholeskyBase *cholesky)
+  {
+    barrierCholesky_ = cholesky;
+  }
+  /** Barrier warm start.  If nonzero and no presolve, barrier starts from
+      solution in model pushed this relative distance into interior
+      (see ClpInterior::setWarmStart) */
+  inline double barrierWarmStart() const
+  {
+    return barrierWarmStart_;
+  }
+  inline void setBarrierWarmStart(double value)
+  {
+    barrierWarmStart_ = value;
+  }
+  /** Whether crossover after barrier races a primal and a dual cleanup
+      from the interior basis on separate threads (needs ABOCA_LITE) */
+  inline bool parallelCrossover() const
+  {
+    return parallelCrossover_;
+  }
+  inline void setParallelCrossover(bool yesNo)
+  {
+    parallelCrossover_ = yesNo;
+  }
+  /// Cpu time taken by last crossover
+  inline double crossoverTime() const
+  {
+    return crossoverTime_;
+  }
+  /// Simplex pivots taken by last crossover
+  inline int crossoverIterations() const
+  {
+    return crossoverIterations_;
+  }
+  /// Set crossover statistics (done by initialSolve)
+  inline void setCrossoverStatistics(double time, int iterations)
+  {
+    crossoverTime_ = time;
+    crossoverIterations_ = iterations;
+  }
   //@}
 
   ////////////////// data //////////////////
@@ -302,6 +363,18 @@ private:
 	 If Dantzig Wolfe/benders 0 is number blocks, 2 is #passes (notional)
      */
   int independentOptions_[3];
+  /// Cache of scale factors (not owned)
+  ClpScaleCache *scaleCache_;
+  /// Cholesky kept between barrier solves (not owned)
+  ClpCholeskyBase *barrierCholesky_;
+  /// Barrier warm start distance (0.0 cold)
+  double barrierWarmStart_;
+  /// Cpu time taken by last crossover
+  double crossoverTime_;
+  /// Pivots taken by last crossover
+  int crossoverIterations_;
+  /// Race primal and dual in crossover
+  bool parallelCrossover_;
   //@}
 };
 
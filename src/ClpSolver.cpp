@@ -215,6 +215,9 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
 #endif
   // default action on import
   int allowImportErrors = 0;
+#ifdef ABC_INHERIT
+  int abcDeterministic = 0;
+#endif
   int keepImportNames = 1;
   int doIdiot = -1;
   int outputFormat = 2;
@@ -769,9 +772,21 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
           case CLP_PARAM_STR_ERRORSALLOWED:
             allowImportErrors = action;
             break;
+          case CLP_PARAM_STR_DETERMINISTIC:
+#ifdef ABC_INHERIT
+            abcDeterministic = action;
+            // only mark if abc wanted (otherwise done when -abc given)
+            if (models[iModel].abcState()) {
+              int state = models[iModel].abcState() & ~CLP_ABC_DETERMINISTIC;
+              models[iModel].setAbcState(state | (action ? CLP_ABC_DETERMINISTIC : 0));
+            }
+#elif ABOCA_LITE
+            setAbcDeterministic(action != 0);
+#endif
+            break;
           case CLP_PARAM_STR_ABCWANTED:
 #ifdef ABC_INHERIT
-            models[iModel].setAbcState(action);
+            models[iModel].setAbcState((action && abcDeterministic) ? (action | CLP_ABC_DETERMINISTIC) : action);
 #elif ABOCA_LITE
             setAbcState(action);
             {
@@ -810,7 +825,17 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
 #endif
             break;
           case CLP_PARAM_STR_CRASH:
-            doCrash = action;
+            // triangular is last in list but crash 7 in ClpSolve
+#ifdef CLP_INHERIT_MODE
+            if (action == 10)
+#else
+            if (action == 14)
+#endif
+              doCrash = 7;
+            else if (action > 6)
+              doCrash = action + 1;
+            else
+              doCrash = action;
             break;
           case CLP_PARAM_STR_VECTOR:
             doVector = action;
@@ -1002,8 +1027,8 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
               method = ClpSolve::usePrimalorSprint;
             } else if (type == CLP_PARAM_ACTION_EITHERSIMPLEX) {
               method = ClpSolve::automatic;
-              if (doCrash > 6) {
-                solveOptions.setSpecialOption(6, 1, doCrash - 6);
+              if (doCrash > 7) {
+                solveOptions.setSpecialOption(6, 1, doCrash - 7);
                 doCrash = 0;
               }
               if (doIdiot > 0)
@@ -1035,7 +1060,7 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
             }
             if (method == ClpSolve::useDual) {
               // dual
-              if (doCrash && doCrash < 7)
+              if (doCrash && doCrash < 8)
                 solveOptions.setSpecialOption(0, 1, doCrash); // crash
               else if (doIdiot)
                 solveOptions.setSpecialOption(0, 2, doIdiot); // possible idiot
@@ -1049,8 +1074,8 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
                 solveOptions.setSpecialOption(1, 10, slpValue); // slp
                 method = ClpSolve::usePrimal;
               }
-              if (doCrash > 6) {
-                solveOptions.setSpecialOption(6, 1, doCrash - 6);
+              if (doCrash > 7) {
+                solveOptions.setSpecialOption(6, 1, doCrash - 7);
                 doCrash = 0;
               }
               if (doCrash > 0) {
@@ -2216,6 +2241,31 @@ int ClpMain1(int argc, const char *argv[], AbcSimplex *models)
             solveOptions, specialOptions, doVector != 0);
 #endif
         } break;
+        case CLP_PARAM_ACTION_BENCHMARK: {
+          // create fields for unitTest
+          const char *fields[4];
+          int nFields = 4;
+          fields[0] = "fake main from unitTest";
+          std::string mpsfield = "-dirSample=";
+          mpsfield += dirSample.c_str();
+          fields[1] = mpsfield.c_str();
+          std::string netfield = "-dirNetlib=";
+          netfield += dirNetlib.c_str();
+          fields[2] = netfield.c_str();
+          fields[3] = "-benchmark";
+          ClpSolve solveOptions;
+#ifndef ABC_INHERIT
+          int numberRegressions = mainTest(nFields, fields, -1, *thisModel,
+            solveOptions, 0, doVector != 0);
+#else
+          int numberRegressions = mainTest(nFields, fields, -1, *models,
+            solveOptions, 0, doVector != 0);
+#endif
+          if (numberRegressions) {
+            std::cerr << numberRegressions << " benchmark regressions" << std::endl;
+            return 1;
+          }
+        } break;
         case CLP_PARAM_ACTION_FAKEBOUND:
           if (goodModels[iModel]) {
             // get bound
@@ -8,12 +8,18 @@
 
 #include "ClpConfig.h"
 #include "CoinPragma.hpp"
+#if ABOCA_LITE
+// 1 is not owner of abcState_
+#define ABCSTATE_LITE 1
+#endif
 #include <cassert>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <cmath>
 #include <cfloat>
 #include <string>
+#include <vector>
 #include <iostream>
 
 #include "CoinMpsIO.hpp"
@@ -35,12 +41,18 @@
 #include "ClpSimplexOther.hpp"
 #include "ClpSimplexNonlinear.hpp"
 #include "ClpInterior.hpp"
+#include "ClpCholeskyBase.hpp"
+#include "ClpPredictorCorrector.hpp"
+#include "ClpPdcoBase.hpp"
 #include "ClpLinearObjective.hpp"
+#include "ClpQuadraticObjective.hpp"
 #include "ClpDualRowSteepest.hpp"
 #include "ClpDualRowDantzig.hpp"
 #include "ClpPrimalColumnSteepest.hpp"
 #include "ClpPrimalColumnDantzig.hpp"
 #include "ClpParameters.hpp"
+#include "ClpEventHandler.hpp"
+#include "ClpIterationTrace.hpp"
 #include "ClpNetworkMatrix.hpp"
 #include "ClpPlusMinusOneMatrix.hpp"
 #include "MyMessageHandler.hpp"
@@ -85,6 +97,129 @@ static std::string nameBarrier = "barrier-MUMPS";
 static int barrierAvailable = 0;
 static std::string nameBarrier = "barrier-slow";
 #endif
+#if ABOCA_LITE && !defined(ABC_INHERIT)
+#include <atomic>
+// Counts iterations seen by user (clones share count)
+class CountEventHandler : public ClpEventHandler {
+public:
+  CountEventHandler(std::atomic< int > *count)
+    : ClpEventHandler()
+    , count_(count)
+  {
+  }
+  virtual int event(Event whichEvent)
+  {
+    if (whichEvent == endOfIteration)
+      (*count_)++;
+    return -1; // carry on
+  }
+  virtual ClpEventHandler *clone() const
+  {
+    return new CountEventHandler(*this);
+  }
+
+private:
+  std::atomic< int > *count_;
+};
+#endif
+// Entropy objective sum x log x for pdco with A taken from model
+class EntropyPdco : public ClpPdcoBase {
+public:
+  EntropyPdco()
+    : ClpPdcoBase()
+  {
+    d1_ = 1.0e-3;
+    d2_ = 1.0e-3;
+  }
+  virtual void matVecMult(ClpInterior *model, int mode, double *x, double *y) const
+  {
+    matrixVecMult(model, mode, x, y);
+  }
+  virtual void matPrecon(ClpInterior *model, double delta, double *x, double *y) const
+  {
+    matrixPrecon(model, delta, x, y);
+  }
+  virtual double getObj(ClpInterior *model, CoinDenseVector< double > &x) const
+  {
+    const double *x_elts = x.getElements();
+    double obj = 0.0;
+    for (int k = 0; k < model->numberColumns(); k++)
+      obj += x_elts[k] * log(x_elts[k]);
+    return obj;
+  }
+  virtual void getGrad(ClpInterior *model, CoinDenseVector< double > &x,
+    CoinDenseVector< double > &grad) const
+  {
+    const double *x_elts = x.getElements();
+    double *g_elts = grad.getElements();
+    for (int k = 0; k < model->numberColumns(); k++)
+      g_elts[k] = 1.0 + log(x_elts[k]);
+  }
+  virtual void getHessian(ClpInterior *model, CoinDenseVector< double > &x,
+    CoinDenseVector< double > &H) const
+  {
+    const double *x_elts = x.getElements();
+    double *H_elts = H.getElements();
+    for (int k = 0; k < model->numberColumns(); k++)
+      H_elts[k] = 1.0 / x_elts[k];
+  }
+  virtual ClpPdcoBase *clone() const
+  {
+    return new EntropyPdco(*this);
+  }
+};
+// Records parametrics reports (theta, objective and names if basis change)
+class ParametricsRecordHandler : public CoinMessageHandler {
+public:
+  ParametricsRecordHandler()
+    : CoinMessageHandler()
+  {
+    setLogLevel(2);
+  }
+  virtual int print()
+  {
+    int number = currentMessage().externalNumber();
+    if (currentSource() == "Clp" && (number == 62 || number == 63)) {
+      char line[200];
+      sprintf(line, "%d %.9g %.9g", number, doubleValue(0), doubleValue(1));
+      std::string record(line);
+      if (number == 63)
+        record += " " + stringValue(0) + " " + stringValue(1);
+      records_.push_back(record);
+      theta_.push_back(doubleValue(0));
+      objective_.push_back(doubleValue(1));
+    }
+    return 0;
+  }
+  virtual CoinMessageHandler *clone() const
+  {
+    return new ParametricsRecordHandler(*this);
+  }
+  std::vector< std::string > records_;
+  std::vector< double > theta_;
+  std::vector< double > objective_;
+};
+// Notes whether barrier switched to KKT system because of dense columns
+class KKTRecordHandler : public CoinMessageHandler {
+public:
+  KKTRecordHandler()
+    : CoinMessageHandler()
+    , switchedToKKT_(false)
+  {
+    setLogLevel(1);
+  }
+  virtual int print()
+  {
+    if (strstr(messageBuffer(), "factorizing KKT system"))
+      switchedToKKT_ = true;
+    return 0;
+  }
+  virtual CoinMessageHandler *clone() const
+  {
+    return new KKTRecordHandler(*this);
+  }
+  bool switchedToKKT_;
+};
 #define NUMBER_ALGORITHMS 12
 // If you just want a subset then set some to 1
 static int switchOff[NUMBER_ALGORITHMS] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
@@ -270,7 +405,224 @@ void usage(const std::string &key)
     << "    -dirNetlib: directory containing netlib files\"\n"
     << "        Default value V2=\"../../Data/Netlib\"\n"
     << "    -netlib\n"
-    << "        If specified, then netlib testset run as well as the nitTest.\n";
+    << "        If specified, then netlib testset run as well as the nitTest.\n"
+    << "    -benchmark\n"
+    << "        If specified, then only kernel timings are done (see clpBench.json).\n";
+}
+//----------------------------------------------------------------
+// Benchmark of solver kernels
+//----------------------------------------------------------------
+typedef std::vector< std::pair< std::string, double > > ClpBenchResults;
+// Builds reproducible random packing LP (takes arrays - no copies)
+static void benchmarkGenerate(ClpSimplex &model, int numberRows, int numberColumns)
+{
+  CoinSeedRandom(1234567);
+  const int perColumn = 5;
+  CoinBigIndex *start = new CoinBigIndex[numberColumns + 1];
+  int *row = new int[numberColumns * perColumn];
+  double *element = new double[numberColumns * perColumn];
+  double *columnLower = NULL;
+  double *columnUpper = new double[numberColumns];
+  double *objective = new double[numberColumns];
+  double *rowLower = new double[numberRows];
+  double *rowUpper = new double[numberRows];
+  CoinBigIndex numberElements = 0;
+  start[0] = 0;
+  for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+    for (int j = 0; j < perColumn; j++) {
+      int iRow = static_cast< int >(CoinDrand48() * numberRows);
+      bool duplicate = false;
+      for (CoinBigIndex k = start[iColumn]; k < numberElements; k++) {
+        if (row[k] == iRow)
+          duplicate = true;
+      }
+      if (!duplicate) {
+        row[numberElements] = iRow;
+        element[numberElements++] = 1.0 + 9.0 * CoinDrand48();
+      }
+    }
+    start[iColumn + 1] = numberElements;
+    columnUpper[iColumn] = 10.0;
+    objective[iColumn] = -1.0 - CoinDrand48();
+  }
+  for (int iRow = 0; iRow < numberRows; iRow++) {
+    rowLower[iRow] = -COIN_DBL_MAX;
+    rowUpper[iRow] = 10.0 + 90.0 * CoinDrand48();
+  }
+  model.assignProblem(numberColumns, numberRows, start, row, element,
+    columnLower, columnUpper, objective, rowLower, rowUpper);
+}
+// Times kernels and solves on one problem
+static void benchmarkProblem(const ClpSimplex &model, const std::string &name,
+  ClpBenchResults &results)
+{
+  const int numberPasses = 3;
+  int numberRows = model.numberRows();
+  int numberColumns = model.numberColumns();
+  ClpMatrixBase *matrix = model.clpMatrix();
+  CoinBigIndex numberElements = matrix->getNumElements();
+  int numberRepeats = CoinMax(1, static_cast< int >(2000000 / (numberElements + 1)));
+  double *x = new double[CoinMax(numberRows, numberColumns)];
+  double *y = new double[CoinMax(numberRows, numberColumns)];
+  for (int i = 0; i < numberRows; i++)
+    x[i] = 1.0 + (i % 7);
+  // matrix products (best of passes)
+  double best = COIN_DBL_MAX;
+  for (int iPass = 0; iPass < numberPasses; iPass++) {
+    double time1 = CoinGetTimeOfDay();
+    for (int k = 0; k < numberRepeats; k++) {
+      CoinZeroN(y, numberColumns);
+      matrix->transposeTimes(1.0, x, y);
+    }
+    best = CoinMin(best, CoinGetTimeOfDay() - time1);
+  }
+  results.push_back(std::make_pair(name + ".transposeTimes", best / numberRepeats));
+  best = COIN_DBL_MAX;
+  for (int iPass = 0; iPass < numberPasses; iPass++) {
+    double time1 = CoinGetTimeOfDay();
+    for (int k = 0; k < numberRepeats; k++) {
+      CoinZeroN(x, numberRows);
+      matrix->times(1.0, y, x);
+    }
+    best = CoinMin(best, CoinGetTimeOfDay() - time1);
+  }
+  results.push_back(std::make_pair(name + ".times", best / numberRepeats));
+  // end to end solves - dual with profile of kernels
+  {
+    ClpSimplex solver(model);
+    solver.setLogLevel(0);
+    solver.setProfiling(true);
+    double time1 = CoinGetTimeOfDay();
+    solver.dual();
+    results.push_back(std::make_pair(name + ".dual", CoinGetTimeOfDay() - time1));
+    const ClpProfile *profile = solver.profile();
+    results.push_back(std::make_pair(name + ".dual.factorize",
+      profile->time[ClpProfileFactorize]));
+    results.push_back(std::make_pair(name + ".dual.ftran",
+      profile->time[ClpProfileFtran]));
+    results.push_back(std::make_pair(name + ".dual.btran",
+      profile->time[ClpProfileBtran]));
+    results.push_back(std::make_pair(name + ".dual.pricing",
+      profile->time[ClpProfilePricing]));
+    results.push_back(std::make_pair(name + ".dual.ratioTest",
+      profile->time[ClpProfileRatioTest]));
+    solver.setProfiling(false);
+    // ftran and btran on optimal basis (keep factorization)
+    solver.primal(0, 3 + 4);
+    int numberSolves = CoinMin(numberRows, 1000);
+    double *work = new double[numberRows];
+    best = COIN_DBL_MAX;
+    for (int iPass = 0; iPass < numberPasses; iPass++) {
+      double time1 = CoinGetTimeOfDay();
+      for (int i = 0; i < numberSolves; i++)
+        solver.getBInvCol(i, work);
+      best = CoinMin(best, CoinGetTimeOfDay() - time1);
+    }
+    results.push_back(std::make_pair(name + ".ftran", best / numberSolves));
+    best = COIN_DBL_MAX;
+    for (int iPass = 0; iPass < numberPasses; iPass++) {
+      double time1 = CoinGetTimeOfDay();
+      for (int i = 0; i < numberSolves; i++)
+        solver.getBInvRow(i, work);
+      best = CoinMin(best, CoinGetTimeOfDay() - time1);
+    }
+    results.push_back(std::make_pair(name + ".btran", best / numberSolves));
+    delete[] work;
+  }
+  {
+    ClpSimplex solver(model);
+    solver.setLogLevel(0);
+    double time1 = CoinGetTimeOfDay();
+    solver.primal();
+    results.push_back(std::make_pair(name + ".primal", CoinGetTimeOfDay() - time1));
+  }
+#ifndef SLIM_CLP
+  {
+    ClpSimplex solver(model);
+    solver.setLogLevel(0);
+    double time1 = CoinGetTimeOfDay();
+    solver.barrier(false);
+    results.push_back(std::make_pair(name + ".barrier", CoinGetTimeOfDay() - time1));
+  }
+#endif
+  delete[] x;
+  delete[] y;
+}
+/* Times kernels on generated, sample and netlib problems, writes
+   clpBench.json and compares with clpBenchBaseline.json if it exists.
+   Returns number of regressions */
+static int ClpBenchmark(const std::string &dirSample, const std::string &dirNetlib)
+{
+  ClpBenchResults results;
+  {
+    ClpSimplex model;
+    benchmarkGenerate(model, 2000, 6000);
+    benchmarkProblem(model, "generated", results);
+  }
+  std::vector< std::string > fileNames;
+  fileNames.push_back(dirSample + "finnis");
+  fileNames.push_back(dirNetlib + "25fv47");
+  fileNames.push_back(dirNetlib + "80bau3b");
+  fileNames.push_back(dirNetlib + "degen3");
+  fileNames.push_back(dirNetlib + "greenbea");
+  for (size_t iFile = 0; iFile < fileNames.size(); iFile++) {
+    CoinMpsIO m;
+    m.messageHandler()->setLogLevel(0);
+    if (m.readMps(fileNames[iFile].c_str(), "mps")) {
+      std::cerr << "Benchmark skipping " << fileNames[iFile] << std::endl;
+      continue;
+    }
+    ClpSimplex model;
+    model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+      m.getObjCoefficients(),
+      m.getRowLower(), m.getRowUpper());
+    std::string name = fileNames[iFile];
+    std::string::size_type slash = name.find_last_of("/\\");
+    if (slash != std::string::npos)
+      name = name.substr(slash + 1);
+    benchmarkProblem(model, name, results);
+  }
+  FILE *fp = fopen("clpBench.json", "w");
+  if (fp) {
+    fprintf(fp, "{\n");
+    for (size_t i = 0; i < results.size(); i++)
+      fprintf(fp, "  \"%s\": %.9g%s\n", results[i].first.c_str(),
+        results[i].second, i + 1 < results.size() ? "," : "");
+    fprintf(fp, "}\n");
+    fclose(fp);
+  }
+  // compare with baseline - ignore differences below 10 milliseconds
+  int numberRegressions = 0;
+  fp = fopen("clpBenchBaseline.json", "r");
+  if (fp) {
+    const double tolerance = 1.25;
+    std::map< std::string, double > baseline;
+    char line[512];
+    char key[256];
+    double value;
+    while (fgets(line, sizeof(line), fp)) {
+      if (sscanf(line, " \"%255[^\"]\": %lf", key, &value) == 2)
+        baseline[key] = value;
+    }
+    fclose(fp);
+    for (size_t i = 0; i < results.size(); i++) {
+      std::map< std::string, double >::const_iterator it = baseline.find(results[i].first);
+      if (it == baseline.end())
+        continue;
+      double time = results[i].second;
+      if (time > tolerance * it->second && time - it->second > 0.01) {
+        printf("Regression %s took %g against baseline %g\n",
+          results[i].first.c_str(), time, it->second);
+        numberRegressions++;
+      }
+    }
+    printf("Benchmark %d timings, %d regressions against baseline\n",
+      static_cast< int >(results.size()), numberRegressions);
+  } else {
+    printf("Benchmark %d timings written to clpBench.json - no baseline\n",
+      static_cast< int >(results.size()));
+  }
+  return numberRegressions;
 }
 #if FACTORIZATION_STATISTICS
 int loSizeX = -1;
@@ -307,6 +659,7 @@ int mainTest(int argc, const char *argv[], int algorithm,
   definedKeyWords.insert("-dirSample");
   definedKeyWords.insert("-dirNetlib");
   definedKeyWords.insert("-netlib");
+  definedKeyWords.insert("-benchmark");
 
   // Create a map of parameter keys and associated data
   std::map< std::string, std::string > parms;
@@ -348,6 +701,8 @@ int mainTest(int argc, const char *argv[], int algorithm,
     dirNetlib = parms["-dirNetlib"];
   else
     dirNetlib = dirsep == '/' ? "../../Data/Netlib/" : "..\\..\\Data\\Netlib\\";
+  if (parms.find("-benchmark") != parms.end())
+    return ClpBenchmark(dirSample, dirNetlib);
 #if FACTORIZATION_STATISTICS == 0
   if (!empty.numberRows()) {
     testingMessage("Testing ClpSimplex\n");
@@ -1708,6 +2063,93 @@ void ClpSimplexUnitTest(const std::string &dirSample)
                               NULL, NULL, rhs, rhs, NULL);
 #endif
   }
+  // Test parametrics on sub-intervals gives same as one sweep
+  {
+    // min -sum (j+1)*x(j), sum x(j) <= 2.5+theta, 0<=x(j)<=1
+    int numberColumns = 6;
+    CoinBigIndex start[7];
+    int row[6];
+    double element[6];
+    double objective[6];
+    double columnLower[6];
+    double columnUpper[6];
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      start[iColumn] = iColumn;
+      row[iColumn] = 0;
+      element[iColumn] = 1.0;
+      objective[iColumn] = -(iColumn + 1.0);
+      columnLower[iColumn] = 0.0;
+      columnUpper[iColumn] = 1.0;
+    }
+    start[numberColumns] = numberColumns;
+    double rowLower = -COIN_DBL_MAX;
+    double rowUpper = 2.5;
+    double changeUpperRhs = 1.0;
+    // last two passes have sub-intervals which start infeasible
+    for (int iPass = 0; iPass < 4; iPass++) {
+      double reportIncrement = (iPass & 1) ? 0.0 : 0.5;
+      ParametricsRecordHandler handler[2];
+      double endingTheta[2];
+      int returnCode[2];
+      int status[2][7];
+      double objectiveValue[2];
+      for (int iTry = 0; iTry < 2; iTry++) {
+        ClpSimplex model;
+        model.loadProblem(numberColumns, 1, start, row, element,
+          columnLower, columnUpper, objective, &rowLower, &rowUpper);
+        if (iPass >= 2) {
+          // rhs 1.5-theta must be at least 1.0 as x(0) fixed at 1.0
+          model.setColumnLower(0, 1.0);
+          model.setColumnUpper(0, 1.0);
+          model.setRowLower(0, 1.5);
+          model.setRowUpper(0, 1.5);
+        }
+        model.scaling(0);
+        model.setLogLevel(0);
+        model.dual();
+        model.passInMessageHandler(handler + iTry);
+        ClpSimplexOther *model2 = static_cast< ClpSimplexOther * >(&model);
+        double change = -1.0;
+        endingTheta[iTry] = 6.0;
+        // rows move up (or down for last two passes)
+        const double *lowerChangeRhs = iPass >= 2 ? &change : NULL;
+        const double *upperChangeRhs = iPass >= 2 ? &change : &changeUpperRhs;
+        if (!iTry)
+          returnCode[iTry] = model2->parametrics(0.0, endingTheta[iTry],
+            reportIncrement, NULL, NULL, lowerChangeRhs, upperChangeRhs, NULL);
+        else
+          returnCode[iTry] = model2->parametricsParallel(3, 0.0, endingTheta[iTry],
+            reportIncrement, NULL, NULL, lowerChangeRhs, upperChangeRhs, NULL);
+        for (int i = 0; i < numberColumns; i++)
+          status[iTry][i] = model.getColumnStatus(i);
+        status[iTry][6] = model.getRowStatus(0);
+        objectiveValue[iTry] = model.objectiveValue();
+      }
+      assert(returnCode[0] == returnCode[1]);
+      assert(fabs(endingTheta[0] - endingTheta[1]) < 1.0e-7);
+      assert(fabs(objectiveValue[0] - objectiveValue[1]) < 1.0e-7);
+      for (int i = 0; i < 7; i++)
+        assert(status[0][i] == status[1][i]);
+      if (reportIncrement) {
+        // reports at same theta
+        assert(handler[0].theta_.size() == handler[1].theta_.size());
+        for (size_t k = 0; k < handler[0].theta_.size(); k++) {
+          assert(fabs(handler[0].theta_[k] - handler[1].theta_[k]) < 1.0e-7);
+          assert(fabs(handler[0].objective_[k] - handler[1].objective_[k]) < 1.0e-7);
+        }
+      } else {
+        // same basis changes (extra reports where sub-intervals meet)
+        std::vector< std::string > changes[2];
+        for (int iTry = 0; iTry < 2; iTry++) {
+          for (size_t k = 0; k < handler[iTry].records_.size(); k++) {
+            if (handler[iTry].records_[k][1] == '3')
+              changes[iTry].push_back(handler[iTry].records_[k]);
+          }
+        }
+        assert(changes[0] == changes[1]);
+      }
+    }
+  }
   // Test binv etc
   {
     /*
@@ -1864,6 +2306,324 @@ void ClpSimplexUnitTest(const std::string &dirSample)
     model.setWhatsChanged(model.whatsChanged() & (~512));
     model.dual(0, 2); // hopefully will not use factorization
   }
+  // test taking over arrays with zeros and duplicates cleaned
+  {
+    // column 0 has duplicates which cancel, column 1 an explicit zero
+    // and column 2 duplicates which add
+    CoinBigIndex *start = new CoinBigIndex[4];
+    int *row = new int[8];
+    double *element = new double[8];
+    int rowIn[8] = { 0, 1, 0, 1, 0, 0, 1, 1 };
+    double elementIn[8] = { 1.0, 2.0, -1.0, 0.0, 3.0, 1.0, 1.0, 2.0 };
+    CoinMemcpyN(rowIn, 8, row);
+    CoinMemcpyN(elementIn, 8, element);
+    start[0] = 0;
+    start[1] = 3;
+    start[2] = 5;
+    start[3] = 8;
+    double *columnLower = NULL;
+    double *columnUpper = new double[3];
+    CoinFillN(columnUpper, 3, 10.0);
+    double *objective = new double[3];
+    objective[0] = -1.0;
+    objective[1] = -1.0;
+    objective[2] = -2.0;
+    double *rowLower = NULL;
+    double *rowUpper = new double[2];
+    rowUpper[0] = 6.0;
+    rowUpper[1] = 6.0;
+    ClpSimplex model;
+    int numberDuplicates = model.assignProblem(3, 2, start, row, element,
+      columnLower, columnUpper, objective, rowLower, rowUpper, 3);
+    assert(numberDuplicates == 2);
+    assert(!start && !row && !element && !columnUpper && !objective && !rowUpper);
+    // status must be there as for loadProblem
+    assert(model.statusArray());
+    ClpPackedMatrix *clpMatrix = dynamic_cast< ClpPackedMatrix * >(model.clpMatrix());
+    assert(clpMatrix);
+    assert((clpMatrix->flags() & 1) == 0);
+    const CoinPackedMatrix *matrix = clpMatrix->getPackedMatrix();
+    assert(matrix->getNumElements() == 4);
+    const CoinBigIndex *columnStart = matrix->getVectorStarts();
+    const int *columnLength = matrix->getVectorLengths();
+    const int *rowOut = matrix->getIndices();
+    const double *elementOut = matrix->getElements();
+    assert(columnLength[0] == 1 && columnLength[1] == 1 && columnLength[2] == 2);
+    for (int iColumn = 0; iColumn < 3; iColumn++) {
+      for (CoinBigIndex j = columnStart[iColumn];
+           j < columnStart[iColumn] + columnLength[iColumn]; j++)
+        assert(elementOut[j]);
+    }
+    assert(rowOut[columnStart[0]] == 1 && elementOut[columnStart[0]] == 2.0);
+    assert(rowOut[columnStart[1]] == 0 && elementOut[columnStart[1]] == 3.0);
+    model.setLogLevel(0);
+    model.primal();
+    assert(!model.status());
+    // same problem loaded in the usual way
+    int rowClean[4] = { 1, 0, 0, 1 };
+    double elementClean[4] = { 2.0, 3.0, 1.0, 3.0 };
+    CoinBigIndex startClean[4] = { 0, 1, 2, 4 };
+    double upperClean[3] = { 10.0, 10.0, 10.0 };
+    double objectiveClean[3] = { -1.0, -1.0, -2.0 };
+    double rowUpperClean[2] = { 6.0, 6.0 };
+    ClpSimplex model2;
+    model2.loadProblem(3, 2, startClean, rowClean, elementClean,
+      NULL, upperClean, objectiveClean, NULL, rowUpperClean);
+    model2.setLogLevel(0);
+    model2.primal();
+    assert(fabs(model.objectiveValue() - model2.objectiveValue()) < 1.0e-8);
+  }
+  // test re-solves only redoing changed costs and bounds
+  {
+    double obj[2] = { -4.0, 1.0 };
+    double collb[2] = { 0.0, 0.0 };
+    double colub[2] = { COIN_DBL_MAX, COIN_DBL_MAX };
+    double rowlb[3] = { -COIN_DBL_MAX, -COIN_DBL_MAX, -COIN_DBL_MAX };
+    double rowub[3] = { 14.0, 3.0, 3.0 };
+    int rowIndices[5] = { 0, 2, 0, 1, 2 };
+    int colIndices[5] = { 0, 0, 1, 1, 1 };
+    double elements[5] = { 7.0, 2.0, -2.0, 1.0, -2.0 };
+    CoinPackedMatrix M(true, rowIndices, colIndices, elements, 5);
+    ClpSimplex model;
+    model.loadProblem(M, collb, colub, obj, rowlb, rowub);
+    model.startPermanentArrays();
+    model.dual(0, 1 + 4);
+    double upper[3] = { 1.0, 0.5, 2.0 };
+    for (int iPass = 0; iPass < 3; iPass++) {
+      if (iPass < 2) {
+        model.setColumnUpper(0, upper[iPass]);
+        model.setObjectiveCoefficient(1, 1.0 + iPass);
+      } else {
+        // written straight into model arrays must be picked up as well
+        model.columnUpper()[0] = upper[iPass];
+        model.objective()[1] = 1.0 + iPass;
+      }
+      int numberIncremental = model.numberIncrementalRims();
+      model.dual(0, 1 + 4);
+      assert(model.numberIncrementalRims() > numberIncremental);
+      ClpSimplex model2;
+      model2.loadProblem(M, collb, colub, obj, rowlb, rowub);
+      model2.setColumnUpper(0, upper[iPass]);
+      model2.setObjectiveCoefficient(1, 1.0 + iPass);
+      model2.dual();
+      assert(!model.status());
+      assert(fabs(model.objectiveValue() - model2.objectiveValue()) < 1.0e-8);
+    }
+    // copies keep permanent arrays but must redo everything once
+    double objValue = model.objectiveValue();
+    ClpSimplex model3(model);
+    ClpSimplex model4;
+    model4 = model;
+    for (int iCopy = 0; iCopy < 2; iCopy++) {
+      ClpSimplex &copy = iCopy ? model4 : model3;
+      assert((copy.specialOptions() & 65536) != 0);
+      copy.dual(0, 1 + 4);
+      assert(!copy.status());
+      assert(!copy.numberIncrementalRims());
+      assert(fabs(copy.objectiveValue() - objValue) < 1.0e-8);
+      copy.setObjectiveCoefficient(1, 1.0);
+      copy.dual(0, 1 + 4);
+      assert(!copy.status());
+      assert(copy.numberIncrementalRims() == 1);
+    }
+  }
+  // test phase profiling
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "exmip1";
+    m.readMps(fn.c_str(), "mps");
+    ClpSimplex model;
+    model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+      m.getObjCoefficients(),
+      m.getRowLower(), m.getRowUpper());
+    assert(!model.profile());
+    model.setProfiling(true);
+    model.dual();
+    const ClpProfile *profile = model.profile();
+    assert(profile);
+    assert(profile->count[ClpProfileFactorize] > 0);
+    assert(profile->count[ClpProfileCreateRim] > 0);
+    assert(!model.numberIterations() || profile->count[ClpProfileBtran] > 0);
+    model.setProfiling(false);
+    assert(!model.profile());
+    // and iteration trace
+    ClpIterationTrace trace(1000);
+    model.setIterationTrace(&trace);
+    model.allSlackBasis();
+    model.dual();
+    model.setIterationTrace(NULL);
+    ClpIterationRecord records[1000];
+    int n = trace.drain(records, 1000);
+    assert(n > 0 && n <= model.numberIterations());
+    assert(records[n - 1].iteration <= model.numberIterations());
+    assert(!trace.drain(records, 1000));
+  }
+  // test scale cache
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "exmip1";
+    m.readMps(fn.c_str(), "mps");
+    ClpSimplex model;
+    model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+      m.getObjCoefficients(),
+      m.getRowLower(), m.getRowUpper());
+    ClpSimplex model2(model);
+    ClpScaleCache cache;
+    ClpSolve solveOptions;
+    solveOptions.setPresolveType(ClpSolve::presolveOff);
+    solveOptions.setScaleCache(&cache);
+    model.initialSolve(solveOptions);
+    assert(cache.numberEntries() == 1 && !cache.numberHits());
+    // same pattern so should find
+    model2.initialSolve(solveOptions);
+    assert(cache.numberHits() == 1);
+    assert(fabs(model2.objectiveValue() - model.objectiveValue()) < 1.0e-7 * (1.0 + fabs(model.objectiveValue())));
+  }
+  // test triangular crash
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "exmip1";
+    m.readMps(fn.c_str(), "mps");
+    ClpSimplex model;
+    model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+      m.getObjCoefficients(),
+      m.getRowLower(), m.getRowUpper());
+    model.dual();
+    double objValue = model.objectiveValue();
+    model.allSlackBasis();
+    model.crash(0.0, 6);
+    {
+      /* Basis must be triangular - keep taking a basic structural with
+         one element in rows whose slack is nonbasic */
+      int numberRows = model.numberRows();
+      int numberColumns = model.numberColumns();
+      const CoinPackedMatrix *matrix = model.matrix();
+      const int *row = matrix->getIndices();
+      const CoinBigIndex *columnStart = matrix->getVectorStarts();
+      const int *columnLength = matrix->getVectorLengths();
+      char *rowLeft = new char[numberRows];
+      char *columnLeft = new char[numberColumns];
+      int numberLeft = 0;
+      int numberRowsLeft = 0;
+      for (int iRow = 0; iRow < numberRows; iRow++) {
+        rowLeft[iRow] = (model.getRowStatus(iRow) != ClpSimplex::basic) ? 1 : 0;
+        numberRowsLeft += rowLeft[iRow];
+      }
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+        columnLeft[iColumn] = (model.getColumnStatus(iColumn) == ClpSimplex::basic) ? 1 : 0;
+        numberLeft += columnLeft[iColumn];
+      }
+      assert(numberLeft > 0);
+      assert(numberLeft == numberRowsLeft);
+      bool progress = true;
+      while (numberLeft && progress) {
+        progress = false;
+        for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+          if (!columnLeft[iColumn])
+            continue;
+          int nInRows = 0;
+          int kRow = -1;
+          for (CoinBigIndex j = columnStart[iColumn];
+               j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+            if (rowLeft[row[j]]) {
+              nInRows++;
+              kRow = row[j];
+            }
+          }
+          if (nInRows == 1) {
+            columnLeft[iColumn] = 0;
+            rowLeft[kRow] = 0;
+            numberLeft--;
+            progress = true;
+          }
+        }
+      }
+      assert(!numberLeft);
+      delete[] rowLeft;
+      delete[] columnLeft;
+    }
+    model.dual();
+    assert(model.isProvenOptimal());
+    assert(fabs(model.objectiveValue() - objValue) < 1.0e-7 * (1.0 + fabs(objValue)));
+  }
+#if ABOCA_LITE || defined(ABC_INHERIT)
+  // test deterministic mode gives same iterations and solution for 1 and 4 threads
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "brandy";
+    if (!m.readMps(fn.c_str(), "mps")) {
+      int numberIterations[2];
+      double objValue[2];
+      double *solution[2];
+      int numberColumns = m.getNumCols();
+#ifndef ABC_INHERIT
+      // every pivot so iterates can be compared
+      const int maximumRecords = 20000;
+      ClpIterationRecord *records[2];
+      int numberRecords[2];
+#endif
+      for (int iPass = 0; iPass < 2; iPass++) {
+        int numberThreads = iPass ? 4 : 1;
+        ClpSimplex model;
+        model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+          m.getObjCoefficients(),
+          m.getRowLower(), m.getRowUpper());
+        model.setLogLevel(0);
+#ifdef ABC_INHERIT
+        // goes through whileIteratingParallel
+        model.setAbcState(numberThreads | CLP_ABC_DETERMINISTIC);
+        ClpSolve solveOptions;
+        solveOptions.setSolveType(ClpSolve::useDual);
+        solveOptions.setPresolveType(ClpSolve::presolveOff);
+        model.initialSolve(solveOptions);
+#else
+        int saveState = abcState();
+        setAbcState(numberThreads);
+        // without flag work is split by number of threads
+        assert(abcState() == numberThreads);
+        setAbcDeterministic(true);
+        // with flag split is same whatever number of threads
+        assert(abcState() == ABOCA_LITE);
+        ClpIterationTrace trace(maximumRecords + 1, 1);
+        model.setIterationTrace(&trace);
+        model.dual();
+        model.setIterationTrace(NULL);
+        setAbcState(saveState);
+        setAbcDeterministic(false);
+        assert(!trace.numberDropped());
+        records[iPass] = new ClpIterationRecord[maximumRecords];
+        numberRecords[iPass] = trace.drain(records[iPass], maximumRecords);
+#endif
+        assert(model.isProvenOptimal());
+        numberIterations[iPass] = model.numberIterations();
+        objValue[iPass] = model.objectiveValue();
+        solution[iPass] = CoinCopyOfArray(model.primalColumnSolution(), numberColumns);
+      }
+      assert(numberIterations[0] == numberIterations[1]);
+      assert(objValue[0] == objValue[1]);
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+        assert(solution[0][iColumn] == solution[1][iColumn]);
+      delete[] solution[0];
+      delete[] solution[1];
+#ifndef ABC_INHERIT
+      // same pivots with identical theta, alpha and objective each iteration
+      assert(numberRecords[0] && numberRecords[0] == numberRecords[1]);
+      for (int i = 0; i < numberRecords[0]; i++) {
+        const ClpIterationRecord &record0 = records[0][i];
+        const ClpIterationRecord &record1 = records[1][i];
+        assert(record0.iteration == record1.iteration);
+        assert(record0.sequenceIn == record1.sequenceIn);
+        assert(record0.sequenceOut == record1.sequenceOut);
+        assert(record0.theta == record1.theta);
+        assert(record0.alpha == record1.alpha);
+        assert(record0.objective == record1.objective);
+      }
+      delete[] records[0];
+      delete[] records[1];
+#endif
+    }
+  }
+#endif
   // test steepest edge
   {
     CoinMpsIO m;
@@ -1892,6 +2652,27 @@ void ClpSimplexUnitTest(const std::string &dirSample)
       solution.setDualRowPivotAlgorithm(steep);
       solution.setDblParam(ClpObjOffset, m.objectiveOffset());
       solution.dual();
+      // same again choosing sparse or dense solves from measured density
+      ClpSimplex solution2(model);
+      solution2.scaling(1);
+      solution2.setDualBound(1.0e8);
+      solution2.setDualTolerance(1.0e-7);
+      solution2.setDualRowPivotAlgorithm(steep);
+      solution2.setDblParam(ClpObjOffset, m.objectiveOffset());
+      solution2.factorization()->setHyperSparseMode(1);
+      solution2.dual();
+      CoinRelFltEq eq(1.0e-7);
+      assert(eq(solution2.objectiveValue(), solution.objectiveValue()));
+      int numberSolves = 0;
+      for (int iType = 0; iType < 3; iType++) {
+        int numberSparse, numberDense;
+        double averageDensity;
+        solution2.factorization()->hyperSparseStatistics(iType, numberSparse,
+          numberDense, averageDensity);
+        assert(averageDensity >= 0.0 && averageDensity <= 1.0);
+        numberSolves += numberSparse + numberDense;
+      }
+      assert(numberSolves > 0);
     }
   }
   // test normal solution
@@ -2329,6 +3110,118 @@ void ClpSimplexUnitTest(const std::string &dirSample)
       std::cerr << "Error reading brandy from sample data. Skipping test." << std::endl;
     }
   }
+#if ABOCA_LITE && !defined(ABC_INHERIT)
+  // test concurrent crossover calls user handler and is repeatable in deterministic mode
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "brandy";
+    if (!m.readMps(fn.c_str(), "mps")) {
+      setAbcDeterministic(true);
+      int numberIterations[2];
+      double objValue[2];
+      for (int iPass = 0; iPass < 2; iPass++) {
+        ClpSimplex model;
+        model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+          m.getObjCoefficients(),
+          m.getRowLower(), m.getRowUpper());
+        model.setLogLevel(0);
+        std::atomic< int > count(0);
+        CountEventHandler handler(&count);
+        model.passInEventHandler(&handler);
+        ClpSolve solveOptions;
+        solveOptions.setSolveType(ClpSolve::useBarrier);
+        solveOptions.setPresolveType(ClpSolve::presolveOff);
+        solveOptions.setParallelCrossover(true);
+        model.initialSolve(solveOptions);
+        assert(model.isProvenOptimal());
+        if (solveOptions.crossoverIterations())
+          assert(count.load() > 0);
+        numberIterations[iPass] = model.numberIterations();
+        objValue[iPass] = model.objectiveValue();
+      }
+      setAbcDeterministic(false);
+      assert(numberIterations[0] == numberIterations[1]);
+      assert(objValue[0] == objValue[1]);
+    }
+  }
+#endif
+  // test dual long step ratio test gives same optimum as default
+  {
+    const char *names[] = { "afiro", "brandy", "finnis" };
+    for (int iProblem = 0; iProblem < 3; iProblem++) {
+      CoinMpsIO m;
+      m.messageHandler()->setLogLevel(0);
+      std::string fn = dirSample + names[iProblem];
+      if (m.readMps(fn.c_str(), "mps")) {
+        std::cerr << "Error reading " << names[iProblem] << " from sample data. Skipping test." << std::endl;
+        continue;
+      }
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      ClpSimplex model2(model);
+      model.dual();
+      assert(model.isProvenOptimal());
+      double objValue = model.objectiveValue();
+      model2.setMoreSpecialOptions(model2.moreSpecialOptions() | 134217728);
+      model2.dual();
+      assert(model2.isProvenOptimal());
+      assert(fabs(model2.objectiveValue() - objValue) < 1.0e-7 * (1.0 + fabs(objValue)));
+      // and from an advanced basis after bounds changed
+      int numberColumns = model.numberColumns();
+      for (int iColumn = 0; iColumn < numberColumns; iColumn += 7) {
+        double value = model.primalColumnSolution()[iColumn];
+        if (value > 1.0e-5 && model.columnUpper()[iColumn] > 2.0 * value) {
+          model.setColumnUpper(iColumn, 0.5 * value);
+          model2.setColumnUpper(iColumn, 0.5 * value);
+        }
+      }
+      model.dual();
+      model2.dual();
+      assert(model2.status() == model.status());
+      if (model.isProvenOptimal()) {
+        objValue = model.objectiveValue();
+        assert(fabs(model2.objectiveValue() - objValue) < 1.0e-7 * (1.0 + fabs(objValue)));
+      }
+    }
+  }
+#ifdef CLP_BACKGROUND_FACTORIZATION
+  // test background refactorization gives same answer and is used
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "brandy";
+    if (!m.readMps(fn.c_str(), "mps")) {
+      for (int iAlgorithm = 0; iAlgorithm < 2; iAlgorithm++) {
+        ClpSimplex model;
+        model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+          m.getObjCoefficients(),
+          m.getRowLower(), m.getRowUpper());
+        model.setLogLevel(0);
+        ClpSimplex model2(model);
+        if (!iAlgorithm)
+          model2.dual();
+        else
+          model2.primal();
+        double objValue = model2.objectiveValue();
+        model.setFactorizationFrequency(20);
+        model.factorization()->setBackgroundPivots(8);
+        if (!iAlgorithm)
+          model.dual();
+        else
+          model.primal();
+        assert(model.isProvenOptimal());
+        assert(fabs(model.objectiveValue() - objValue) < 1.0e-7 * (1.0 + fabs(objValue)));
+        // replayed pivots not counted after factors installed
+        assert(model.factorization()->pivots() <= model.factorization()->maximumPivots());
+        assert(model.factorization()->numberBackgroundUsed() > 0);
+      }
+    } else {
+      std::cerr << "Error reading brandy from sample data. Skipping test." << std::endl;
+    }
+  }
+#endif
 #if 1
   // Test barrier
   {
@@ -2340,11 +3233,341 @@ void ClpSimplexUnitTest(const std::string &dirSample)
         m.getObjCoefficients(),
         m.getRowLower(), m.getRowUpper());
       solution.primalDual();
+      // correctors decided from factor size so same iterations each time
+      ClpPredictorCorrector *predictor = static_cast< ClpPredictorCorrector * >(&solution);
+      // tiny factor is cheap so only one corrector
+      assert(predictor->maximumCorrectors() == 1);
+      int numberIterations = solution.numberIterations();
+      double objValue = solution.objectiveValue();
+      ClpInterior solution2;
+      solution2.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      solution2.primalDual();
+      assert(solution2.numberIterations() == numberIterations);
+      assert(solution2.objectiveValue() == objValue);
     } else {
       std::cerr << "Error reading exmip1 from sample data. Skipping test." << std::endl;
     }
   }
 #endif
+  // test more correctors where factorize dominates - prints barrier iterations
+  {
+    const char *names[] = { "afiro", "brandy", "e226" };
+    for (int iProblem = 0; iProblem < 3; iProblem++) {
+      CoinMpsIO m;
+      m.messageHandler()->setLogLevel(0);
+      std::string fn = dirSample + names[iProblem];
+      if (m.readMps(fn.c_str(), "mps")) {
+        std::cerr << "Error reading " << names[iProblem] << " from sample data. Skipping test." << std::endl;
+        continue;
+      }
+      int numberIterations[2];
+      double objValue[2];
+      int numberCorrectors = 0;
+      for (int iPass = 0; iPass < 2; iPass++) {
+        ClpInterior barrier;
+        barrier.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+          m.getObjCoefficients(),
+          m.getRowLower(), m.getRowUpper());
+        barrier.setLogLevel(0);
+        // first pass one corrector as old choice gave on these
+        if (!iPass)
+          barrier.setCorrectorLimit(1);
+        barrier.primalDual();
+        assert(!barrier.status());
+        numberIterations[iPass] = barrier.numberIterations();
+        objValue[iPass] = barrier.objectiveValue();
+        if (iPass)
+          numberCorrectors = static_cast< ClpPredictorCorrector * >(&barrier)->maximumCorrectors();
+      }
+      printf("%s barrier %d iterations with one corrector, %d with up to %d\n",
+        names[iProblem], numberIterations[0], numberIterations[1], numberCorrectors);
+      assert(fabs(objValue[1] - objValue[0]) < 1.0e-6 * (1.0 + fabs(objValue[0])));
+    }
+  }
+  // test barrier switches to regularized KKT system when dense columns dominate
+  {
+    const int numberRows = 500;
+    const int numberDense = CLP_MAXIMUM_DENSE_COLUMNS + 50;
+    const int denseLength = 150;
+    const int numberSparse = 8000;
+    int numberColumns = numberDense + numberSparse;
+    CoinBigIndex *start = new CoinBigIndex[numberColumns + 1];
+    int *row = new int[numberDense * denseLength + 2 * numberSparse];
+    double *element = new double[numberDense * denseLength + 2 * numberSparse];
+    double *columnUpper = new double[numberColumns];
+    double *objective = new double[numberColumns];
+    double *rowLower = new double[numberRows];
+    double *rowUpper = new double[numberRows];
+    CoinSeedRandom(7654321);
+    CoinBigIndex numberElements = 0;
+    start[0] = 0;
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      if (iColumn < numberDense) {
+        // long enough to be dense and most of work in forming normal equations
+        for (int j = 0; j < denseLength; j++) {
+          row[numberElements] = (iColumn + 3 * j) % numberRows;
+          element[numberElements++] = 0.1 + CoinDrand48();
+        }
+      } else {
+        int iRow = iColumn % numberRows;
+        int jRow = (13 * iColumn + 1) % numberRows;
+        if (jRow == iRow)
+          jRow = (iRow + 1) % numberRows;
+        row[numberElements] = iRow;
+        element[numberElements++] = 1.0 + CoinDrand48();
+        row[numberElements] = jRow;
+        element[numberElements++] = 1.0 + CoinDrand48();
+      }
+      start[iColumn + 1] = numberElements;
+      columnUpper[iColumn] = 10.0;
+      objective[iColumn] = -1.0 - CoinDrand48();
+    }
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+      rowLower[iRow] = -COIN_DBL_MAX;
+      rowUpper[iRow] = 100.0 + 100.0 * CoinDrand48();
+    }
+    ClpSimplex model;
+    model.loadProblem(numberColumns, numberRows, start, row, element,
+      NULL, columnUpper, objective, rowLower, rowUpper);
+    delete[] start;
+    delete[] row;
+    delete[] element;
+    delete[] columnUpper;
+    delete[] objective;
+    delete[] rowLower;
+    delete[] rowUpper;
+    // normal equations
+    ClpSimplex model2(model);
+    model2.setLogLevel(0);
+    ClpSolve solveOptions;
+    solveOptions.setSolveType(ClpSolve::useBarrier);
+    solveOptions.setPresolveType(ClpSolve::presolveOff);
+    // no column is dense so no switch
+    solveOptions.setSpecialOption(1, solveOptions.getSpecialOption(1), numberRows + 1);
+    model2.initialSolve(solveOptions);
+    assert(model2.isProvenOptimal());
+    double objValue = model2.objectiveValue();
+    // automatic choice
+    KKTRecordHandler handler;
+    model.passInMessageHandler(&handler);
+    ClpSolve solveOptions2;
+    solveOptions2.setSolveType(ClpSolve::useBarrier);
+    solveOptions2.setPresolveType(ClpSolve::presolveOff);
+    model.initialSolve(solveOptions2);
+    assert(handler.switchedToKKT_);
+    assert(model.isProvenOptimal());
+    assert(fabs(model.objectiveValue() - objValue) < 1.0e-7 * (1.0 + fabs(objValue)));
+    // barrier alone with regularized KKT factorization
+    ClpInterior barrier;
+    barrier.borrowModel(model2);
+    barrier.setLogLevel(0);
+    ClpCholeskyBase *cholesky = new ClpCholeskyBase();
+    cholesky->setKKT(true);
+    cholesky->setKKTRegularization(1.0e-9, 1.0e-9);
+    barrier.setCholesky(cholesky);
+    barrier.primalDual();
+    assert(!barrier.status());
+    assert(fabs(barrier.objectiveValue() - objValue) < 1.0e-6 * (1.0 + fabs(objValue)));
+    barrier.returnModel(model2);
+  }
+  // test warm start of barrier from ClpSolve keeps ordering and symbolic
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (!m.readMps(fn.c_str(), "mps")) {
+      ClpSimplex model;
+      model.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      model.setLogLevel(0);
+      ClpCholeskyBase *cholesky = new ClpCholeskyBase();
+      ClpSolve solveOptions;
+      solveOptions.setSolveType(ClpSolve::useBarrier);
+      solveOptions.setPresolveType(ClpSolve::presolveOff);
+      solveOptions.setBarrierCholesky(cholesky);
+      model.initialSolve(solveOptions);
+      assert(model.isProvenOptimal());
+      assert(cholesky->structureHash());
+      assert(!cholesky->numberReuses());
+      // perturb costs
+      int numberColumns = model.numberColumns();
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+        double value = model.objective()[iColumn];
+        model.setObjectiveCoefficient(iColumn, value * (1.0 + 0.01 * (iColumn % 3)));
+      }
+      ClpSimplex model2(model);
+      model2.allSlackBasis();
+      model2.dual();
+      assert(model2.isProvenOptimal());
+      double objValue = model2.objectiveValue();
+      solveOptions.setBarrierWarmStart(1.0e-2);
+      model.initialSolve(solveOptions);
+      assert(model.isProvenOptimal());
+      assert(fabs(model.objectiveValue() - objValue) < 1.0e-7 * (1.0 + fabs(objValue)));
+      // order and symbolic were skipped
+      assert(cholesky->numberReuses() == 1);
+      delete cholesky;
+    }
+  }
+  // test saving and restoring ordering and symbolic factorization
+  {
+    CoinMpsIO m;
+    std::string fn = dirSample + "afiro";
+    if (!m.readMps(fn.c_str(), "mps")) {
+      ClpInterior barrier;
+      barrier.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      barrier.setLogLevel(0);
+      barrier.primalDual();
+      double objValue = barrier.objectiveValue();
+      assert(!barrier.cholesky()->saveStructure("cholesky.save"));
+      // same structure - order and symbolic skipped
+      ClpInterior barrier2;
+      barrier2.loadProblem(*m.getMatrixByCol(), m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(),
+        m.getRowLower(), m.getRowUpper());
+      barrier2.setLogLevel(0);
+      ClpCholeskyBase *cholesky = new ClpCholeskyBase();
+      assert(!cholesky->restoreStructure("cholesky.save"));
+      barrier2.setCholesky(cholesky);
+      barrier2.primalDual();
+      assert(cholesky->numberReuses() == 1);
+      assert(fabs(barrier2.objectiveValue() - objValue) < 1.0e-7 * (1.0 + fabs(objValue)));
+      // one more column - must order again
+      CoinPackedMatrix matrix(*m.getMatrixByCol());
+      int numberRows = matrix.getNumRows();
+      int numberColumns = matrix.getNumCols();
+      int row[2] = { 0, numberRows - 1 };
+      double element[2] = { 1.0, 1.0 };
+      matrix.appendCol(2, row, element);
+      double *lower = new double[numberColumns + 1];
+      double *upper = new double[numberColumns + 1];
+      double *objective = new double[numberColumns + 1];
+      CoinMemcpyN(m.getColLower(), numberColumns, lower);
+      CoinMemcpyN(m.getColUpper(), numberColumns, upper);
+      CoinMemcpyN(m.getObjCoefficients(), numberColumns, objective);
+      lower[numberColumns] = 0.0;
+      upper[numberColumns] = 0.0;
+      objective[numberColumns] = 1.0;
+      ClpInterior barrier3;
+      barrier3.loadProblem(matrix, lower, upper, objective,
+        m.getRowLower(), m.getRowUpper());
+      barrier3.setLogLevel(0);
+      cholesky = new ClpCholeskyBase();
+      assert(!cholesky->restoreStructure("cholesky.save"));
+      barrier3.setCholesky(cholesky);
+      barrier3.primalDual();
+      assert(!cholesky->numberReuses());
+      // extra column is fixed at zero so same objective
+      assert(fabs(barrier3.objectiveValue() - objValue) < 1.0e-7 * (1.0 + fabs(objValue)));
+      // same column counts but one element in a different row - exact pattern must not match
+      CoinPackedMatrix matrix2(*m.getMatrixByCol());
+      int *rowIndex = matrix2.getMutableIndices();
+      const CoinBigIndex *columnStart = matrix2.getVectorStarts();
+      const int *columnLength = matrix2.getVectorLengths();
+      for (int iRow = 0; iRow < numberRows; iRow++) {
+        bool inColumn = false;
+        for (CoinBigIndex j = columnStart[0]; j < columnStart[0] + columnLength[0]; j++) {
+          if (rowIndex[j] == iRow)
+            inColumn = true;
+        }
+        if (!inColumn) {
+          rowIndex[columnStart[0]] = iRow;
+          break;
+        }
+      }
+      ClpInterior barrier4;
+      barrier4.loadProblem(matrix2, m.getColLower(), m.getColUpper(),
+        m.getObjCoefficients(), m.getRowLower(), m.getRowUpper());
+      cholesky = new ClpCholeskyBase();
+      assert(!cholesky->restoreStructure("cholesky.save"));
+      // even if hash were to agree
+      assert(!cholesky->reuseStructure(&barrier4, cholesky->structureHash()));
+      delete cholesky;
+      // corrupt file - permuteInverse no longer inverse of permute
+      FILE *fp = fopen("cholesky.save", "rb");
+      std::vector< char > buffer;
+      int c;
+      while ((c = fgetc(fp)) != EOF)
+        buffer.push_back(static_cast< char >(c));
+      fclose(fp);
+      size_t offset = 9 * sizeof(int) + sizeof(unsigned int) + numberRows * sizeof(CoinBigIndex);
+      CoinBigIndex value;
+      memcpy(&value, &buffer[offset], sizeof(CoinBigIndex));
+      value = (value + 1) % numberRows;
+      memcpy(&buffer[offset], &value, sizeof(CoinBigIndex));
+      fp = fopen("cholesky.save", "wb");
+      fwrite(&buffer[0], 1, buffer.size(), fp);
+      fclose(fp);
+      cholesky = new ClpCholeskyBase();
+      assert(cholesky->restoreStructure("cholesky.save") == 2);
+      delete cholesky;
+      delete[] lower;
+      delete[] upper;
+      delete[] objective;
+      remove("cholesky.save");
+    }
+  }
+  // test barrier with more dense columns than old limit of 100
+  {
+    int numberRows = 200;
+    int numberSparse = 200;
+    int numberDense = 120;
+    int numberColumns = numberSparse + numberDense;
+    CoinBigIndex *start = new CoinBigIndex[numberColumns + 1];
+    int *row = new int[2 * numberSparse + numberDense * numberRows];
+    double *element = new double[2 * numberSparse + numberDense * numberRows];
+    double *objective = new double[numberColumns];
+    double *columnUpper = new double[numberColumns];
+    double *rowLower = new double[numberRows];
+    CoinBigIndex numberElements = 0;
+    start[0] = 0;
+    for (int iColumn = 0; iColumn < numberSparse; iColumn++) {
+      row[numberElements] = iColumn;
+      element[numberElements++] = 1.0;
+      row[numberElements] = (iColumn + 1) % numberRows;
+      element[numberElements++] = 1.0;
+      objective[iColumn] = 1.0 + 0.1 * (iColumn % 5);
+      columnUpper[iColumn] = 10.0;
+      start[iColumn + 1] = numberElements;
+    }
+    for (int iColumn = numberSparse; iColumn < numberColumns; iColumn++) {
+      for (int iRow = 0; iRow < numberRows; iRow++) {
+        row[numberElements] = iRow;
+        element[numberElements++] = 1.0 + 0.1 * ((iRow + iColumn) % 7);
+      }
+      objective[iColumn] = 50.0 + (iColumn % 11);
+      columnUpper[iColumn] = 10.0;
+      start[iColumn + 1] = numberElements;
+    }
+    for (int iRow = 0; iRow < numberRows; iRow++)
+      rowLower[iRow] = 1.0 + (iRow % 3);
+    CoinPackedMatrix matrix(true, numberRows, numberColumns, numberElements,
+      element, row, start, NULL);
+    ClpSimplex model;
+    model.loadProblem(matrix, NULL, columnUpper, objective, rowLower, NULL);
+    model.setLogLevel(0);
+    model.dual();
+    assert(model.isProvenOptimal());
+    double objValue = model.objectiveValue();
+    ClpInterior barrier;
+    barrier.loadProblem(matrix, NULL, columnUpper, objective, rowLower, NULL);
+    barrier.setLogLevel(0);
+    ClpCholeskyBase *cholesky = new ClpCholeskyBase(numberRows / 2);
+    barrier.setCholesky(cholesky);
+    barrier.primalDual();
+    assert(barrier.cholesky()->numberDenseColumns() == numberDense);
+    assert(fabs(barrier.objectiveValue() - objValue) < 1.0e-5 * (1.0 + fabs(objValue)));
+    delete[] start;
+    delete[] row;
+    delete[] element;
+    delete[] objective;
+    delete[] columnUpper;
+    delete[] rowLower;
+  }
 #if COINUTILS_BIGINDEX_IS_INT
   // test network
 #define QUADRATIC
@@ -2575,6 +3798,143 @@ void ClpSimplexUnitTest(const std::string &dirSample)
       std::cerr << "Error reading exmip1 from sample data. Skipping test." << std::endl;
     }
   }
+  // Test pdco with PCG gives same answer as LSQR
+  {
+    int numberRows = 5;
+    int numberColumns = 12;
+    CoinBigIndex start[13];
+    int row[36];
+    double element[36];
+    CoinBigIndex numberElements = 0;
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      start[iColumn] = numberElements;
+      for (int iRow = 0; iRow < numberRows; iRow++) {
+        if ((iRow + iColumn) % 5 < 3) {
+          row[numberElements] = iRow;
+          element[numberElements++] = 1.0 + 0.1 * ((iRow * 7 + iColumn) % 4);
+        }
+      }
+    }
+    start[numberColumns] = numberElements;
+    CoinPackedMatrix matrix(true, numberRows, numberColumns, numberElements,
+      element, row, start, NULL);
+    // b = A*x0 so x0 feasible
+    double x0 = 1.0 / numberColumns;
+    double b[5] = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+    for (CoinBigIndex j = 0; j < numberElements; j++)
+      b[row[j]] += x0 * element[j];
+    double columnLower[12];
+    double columnUpper[12];
+    double objective[12];
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      columnLower[iColumn] = 0.0;
+      columnUpper[iColumn] = 1.0e20;
+      objective[iColumn] = 0.0;
+    }
+    double solution[2][12];
+    double objectiveValue[2];
+    for (int iPass = 0; iPass < 2; iPass++) {
+      ClpInterior model;
+      model.loadProblem(matrix, columnLower, columnUpper, objective, b, b);
+      model.rhs_ = new double[numberRows];
+      model.y_ = new double[numberRows];
+      for (int iRow = 0; iRow < numberRows; iRow++) {
+        model.rhs_[iRow] = b[iRow];
+        model.y_[iRow] = 0.0;
+      }
+      model.x_ = new double[numberColumns];
+      model.dj_ = new double[numberColumns];
+      for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+        model.x_[iColumn] = x0;
+        model.dj_[iColumn] = 1.0;
+      }
+      model.xsize_ = 1.0;
+      model.zsize_ = 1.0;
+      EntropyPdco stuff;
+      Info info;
+      Outfo outfo;
+      Options options;
+      options.gamma = stuff.getD1();
+      options.delta = stuff.getD2();
+      options.MaxIter = 100;
+      options.FeaTol = 1.0e-6;
+      options.OptTol = 1.0e-6;
+      options.StepTol = 0.99;
+      options.x0min = 0.01;
+      options.z0min = 0.01;
+      options.mu0 = 1.0e-6;
+      // LSQR then PCG
+      options.LSmethod = iPass ? 4 : 3;
+      options.LSproblem = 1;
+      options.LSQRMaxIter = 999;
+      options.LSQRatol1 = 1.0e-3;
+      options.LSQRatol2 = 1.0e-10;
+      options.LSQRconlim = 1.0e12;
+      options.wait = 0;
+      info.atolmin = options.LSQRatol2;
+      info.LSdamp = 0.0;
+      int returnCode = model.pdco(&stuff, options, info, outfo);
+      assert(!returnCode);
+      CoinMemcpyN(model.primalColumnSolution(), numberColumns, solution[iPass]);
+      objectiveValue[iPass] = model.objectiveValue();
+      // still feasible
+      double *rowActivity = new double[numberRows];
+      CoinZeroN(rowActivity, numberRows);
+      matrix.times(solution[iPass], rowActivity);
+      for (int iRow = 0; iRow < numberRows; iRow++)
+        assert(fabs(rowActivity[iRow] - b[iRow]) < 1.0e-4);
+      delete[] rowActivity;
+    }
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+      assert(fabs(solution[0][iColumn] - solution[1][iColumn]) < 1.0e-4);
+    assert(fabs(objectiveValue[0] - objectiveValue[1]) < 1.0e-5);
+  }
+  // Test updated Q*x matches full product after Q changed in place
+  {
+    int numberColumns = 60;
+    CoinBigIndex start[61];
+    int column[180];
+    double element[180];
+    double linear[60];
+    CoinBigIndex numberElements = 0;
+    // half matrix - diagonal and two below it
+    for (int i = 0; i < numberColumns; i++) {
+      start[i] = numberElements;
+      linear[i] = 1.0 - 0.01 * i;
+      for (int j = i; j < CoinMin(i + 3, numberColumns); j++) {
+        column[numberElements] = j;
+        element[numberElements++] = (i == j) ? 4.0 + 0.1 * i : -1.0 + 0.02 * j;
+      }
+    }
+    start[numberColumns] = numberElements;
+    ClpQuadraticObjective quadratic(linear, numberColumns, start, column,
+      element);
+    double solution[60];
+    for (int i = 0; i < numberColumns; i++)
+      solution[i] = 1.0 + 0.5 * (i % 7);
+    double offset;
+    double offset2;
+    quadratic.gradient(NULL, solution, offset, true, 0);
+    for (int iPass = 0; iPass < 3; iPass++) {
+      // few values change so product is updated
+      solution[3 + 17 * iPass] += 2.5;
+      solution[50 - 11 * iPass] -= 1.25;
+      if (iPass == 1) {
+        quadratic.quadraticObjective()->getMutableElements()[7] *= 2.0;
+        quadratic.markChanged();
+      } else if (iPass == 2) {
+        quadratic.quadraticObjective()->modifyCoefficient(31, 30, 3.0);
+        quadratic.markChanged();
+      }
+      const double *gradient = quadratic.gradient(NULL, solution, offset, true, 0);
+      // copy computes from scratch
+      ClpQuadraticObjective full(quadratic);
+      const double *gradient2 = full.gradient(NULL, solution, offset2, true, 0);
+      for (int i = 0; i < numberColumns; i++)
+        assert(fabs(gradient[i] - gradient2[i]) < 1.0e-10);
+      assert(fabs(offset - offset2) < 1.0e-8);
+    }
+  }
   // Test quadratic
   if (1) {
     CoinMpsIO m;